@@ -0,0 +1,170 @@
+#include "AdcSampler.h"
+#include <driver/adc.h>
+#include <esp_timer.h>
+
+// Satu read DMA = ADC_READ_BYTES / 2 sample; frame harus kelipatannya supaya
+// setiap read berakhir tepat di batas frame (cadence frame tetap)
+static_assert(Config::ADC_READ_BYTES % SOC_ADC_DIGI_RESULT_BYTES == 0, "Read DMA harus sample utuh");
+static_assert(ADC_SAMPLES_PER_FRAME % (Config::ADC_READ_BYTES / SOC_ADC_DIGI_RESULT_BYTES) == 0,
+              "ADC_FRAME_SAMPLES harus kelipatan sample per read DMA");
+static_assert(Config::ADC_SAMPLE_RATE_HZ % ADC_SAMPLES_PER_FRAME == 0,
+              "Rate frame (filter) harus sama persis dengan cadence publish");
+
+ChannelFilterConfig adcFilterConfig(AdcChannel channel, float sampleRateHz) {
+    static_assert(sizeof(Config::ADC_FILTER_MEDIAN_TAPS) == ADC_CHANNEL_COUNT, "Satu filter per AdcChannel");
+    const int c = int(channel);
+    ChannelFilterConfig filter;
+    filter.medianTaps = Config::ADC_FILTER_MEDIAN_TAPS[c];
+    filter.alpha = Config::ADC_FILTER_TAU_S[c] > 0.0f ? filterAlphaForTau(Config::ADC_FILTER_TAU_S[c], sampleRateHz)
+                                                      : FILTER_ALPHA_ONE;
+    filter.maxStep = int32_t(Config::ADC_FILTER_MAX_CODES_PER_S[c] / sampleRateHz * (1 << FILTER_INPUT_SHIFT));
+    return filter;
+}
+
+AdcSampler::AdcSampler()
+    : taskHandle(nullptr), activeChannels(0), overruns(0) {
+    for (int c = 0; c < ADC_CHANNEL_COUNT; c++) {
+        adcChannel[c] = -1;
+        filters.configure(c, adcFilterConfig(AdcChannel(c), ADC_FRAME_RATE_HZ));
+    }
+}
+
+AdcSampler::~AdcSampler() {
+    if (taskHandle) {
+        vTaskDelete(taskHandle);
+        taskHandle = nullptr;
+        adc_digi_stop();
+        adc_digi_deinitialize();
+    }
+}
+
+bool AdcSampler::start(const int (&pins)[ADC_CHANNEL_COUNT]) {
+    if (taskHandle) return true;
+
+    // Hanya pin ADC1 (channel 0-7) yang bisa ikut continuous mode
+    uint32_t channelMask = 0;
+    adc_digi_pattern_config_t pattern[ADC_CHANNEL_COUNT] = {};
+    activeChannels = 0;
+    for (int c = 0; c < ADC_CHANNEL_COUNT; c++) {
+        const int channel = adc1ChannelForPin(pins[c]);
+        if (channel < 0 || (channelMask & (1u << channel))) {
+            adcChannel[c] = -1;
+            continue;
+        }
+        adcChannel[c] = channel;
+        channelMask |= 1u << channel;
+
+        pattern[activeChannels].atten = ADC_ATTEN_DB_11;
+        pattern[activeChannels].channel = channel;
+        pattern[activeChannels].unit = 0;  // ADC1
+        pattern[activeChannels].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+        activeChannels++;
+    }
+    if (activeChannels == 0) {
+        Serial.println("ADC sampler: no ADC1 channel - using analogRead");
+        return false;
+    }
+
+    adc_digi_init_config_t initConfig = {};
+    initConfig.max_store_buf_size = Config::ADC_DMA_BUFFER_BYTES;
+    initConfig.conv_num_each_intr = Config::ADC_READ_BYTES;
+    initConfig.adc1_chan_mask = channelMask;
+    initConfig.adc2_chan_mask = 0;
+    if (adc_digi_initialize(&initConfig) != ESP_OK) {
+        Serial.println("ERROR: ADC DMA init failed - using analogRead");
+        return false;
+    }
+
+    adc_digi_configuration_t digiConfig = {};
+    digiConfig.conv_limit_en = 1;  // wajib di ESP32
+    digiConfig.conv_limit_num = 250;
+    digiConfig.pattern_num = activeChannels;
+    digiConfig.adc_pattern = pattern;
+    digiConfig.sample_freq_hz = Config::ADC_SAMPLE_RATE_HZ;
+    digiConfig.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+    digiConfig.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+    if (adc_digi_controller_configure(&digiConfig) != ESP_OK || adc_digi_start() != ESP_OK) {
+        adc_digi_deinitialize();
+        Serial.println("ERROR: ADC DMA config failed - using analogRead");
+        return false;
+    }
+
+    BaseType_t created = xTaskCreatePinnedToCore(taskEntry, "adc_sampler", Config::ADC_TASK_STACK, this,
+                                                 Config::ADC_TASK_PRIORITY, &taskHandle, Config::ADC_TASK_CORE);
+    if (created != pdPASS) {
+        taskHandle = nullptr;
+        adc_digi_stop();
+        adc_digi_deinitialize();
+        Serial.println("ERROR: Cannot create ADC sampler task");
+        return false;
+    }
+
+    Serial.printf("ADC sampler: %d channel(s) at %d Hz total, %d samples/frame\n", activeChannels,
+                  Config::ADC_SAMPLE_RATE_HZ, Config::ADC_FRAME_SAMPLES);
+    return true;
+}
+
+void AdcSampler::taskEntry(void* parameter) {
+    static_cast<AdcSampler*>(parameter)->run();
+}
+
+void AdcSampler::run() {
+    // Channel ADC1 -> index AdcChannel (lookup per sample)
+    int8_t slotOf[8];
+    for (int i = 0; i < 8; i++) slotOf[i] = -1;
+    for (int c = 0; c < ADC_CHANNEL_COUNT; c++) {
+        if (adcChannel[c] >= 0) slotOf[adcChannel[c]] = int8_t(c);
+    }
+
+    uint8_t buffer[Config::ADC_READ_BYTES];
+    uint32_t sums[ADC_CHANNEL_COUNT] = {};
+    uint16_t counts[ADC_CHANNEL_COUNT] = {};
+    uint32_t frameSamples = 0;
+    AdcFrame frame = {};
+
+    for (;;) {
+        uint32_t length = 0;
+        // Blocking sampai satu blok DMA siap; task tidur di antara blok
+        esp_err_t err = adc_digi_read_bytes(buffer, sizeof(buffer), &length, ADC_MAX_DELAY);
+        if (err == ESP_ERR_INVALID_STATE) {
+            overruns++;  // ring driver penuh, sample terlama hilang
+        } else if (err != ESP_OK) {
+            continue;
+        }
+
+        for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+            const adc_digi_output_data_t* sample = reinterpret_cast<const adc_digi_output_data_t*>(&buffer[i]);
+            const uint32_t channel = sample->type1.channel;
+            if (channel >= 8 || slotOf[channel] < 0) continue;
+            sums[slotOf[channel]] += sample->type1.data;
+            counts[slotOf[channel]]++;
+
+            // Frame ditutup tepat di ADC_FRAME_SAMPLES; sisa blok DMA masuk frame berikutnya
+            if (++frameSamples == uint32_t(ADC_SAMPLES_PER_FRAME)) {
+                publishFrame(sums, counts, frame);
+                frameSamples = 0;
+            }
+        }
+    }
+}
+
+void AdcSampler::publishFrame(uint32_t (&sums)[ADC_CHANNEL_COUNT], uint16_t (&counts)[ADC_CHANNEL_COUNT],
+                              AdcFrame& frame) {
+    // Decimation: satu frame rata-rata per channel (Q4 untuk filter), lalu filter bank
+    for (int c = 0; c < ADC_CHANNEL_COUNT; c++) {
+        if (counts[c] > 0) {
+            const int32_t averageQ4 = int32_t((sums[c] << FILTER_INPUT_SHIFT) / counts[c]);
+            frame.raw[c] = averageQ4 * (1.0f / (1 << FILTER_INPUT_SHIFT));
+            frame.filtered[c] = filters.process(c, averageQ4) * (1.0f / (1 << FILTER_INPUT_SHIFT));
+        } else {
+            frame.raw[c] = 0.0f;
+            frame.filtered[c] = 0.0f;
+        }
+        frame.samples[c] = counts[c];
+        sums[c] = 0;
+        counts[c] = 0;
+    }
+    frame.sequence++;
+    frame.timestampMicros = esp_timer_get_time();
+    frameSnapshot.publish(frame);
+}
@@ -0,0 +1,95 @@
+#ifndef ADC_SAMPLER_H
+#define ADC_SAMPLER_H
+
+#include "Config.h"
+#include "SeqlockSnapshot.h"
+#include "FilterBank.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Channel analog yang dibaca SensorManager
+enum class AdcChannel {
+    AFR = 0,
+    MAP,
+    TPS,
+    INCLINE,
+    STROKE,
+    COUNT
+};
+
+static constexpr int ADC_CHANNEL_COUNT = int(AdcChannel::COUNT);
+
+// GPIO -> channel ADC1 (GPIO 36-39 = 0-3, 32-35 = 4-7), -1 jika bukan pin ADC1
+constexpr int adc1ChannelForPin(int pin) {
+    return pin >= 36 && pin <= 39 ? pin - 36 : (pin >= 32 && pin <= 35 ? pin - 28 : -1);
+}
+
+// Frame ditutup setiap ADC_SAMPLES_PER_FRAME sample (run()), jadi rate frame
+// yang dipakai filter (alpha IIR, step rate limiter) diturunkan dari nilai yang sama
+static constexpr int ADC_SAMPLES_PER_FRAME = Config::ADC_FRAME_SAMPLES;
+static constexpr float ADC_FRAME_RATE_HZ = float(Config::ADC_SAMPLE_RATE_HZ) / ADC_SAMPLES_PER_FRAME;
+
+// Filter Config::ADC_FILTER_* satu channel untuk rate sample tertentu (Hz)
+ChannelFilterConfig adcFilterConfig(AdcChannel channel, float sampleRateHz);
+
+// Satu frame hasil decimation: rata-rata raw ADC (0-4095) per channel,
+// dan nilai yang sama setelah filter bank channel tersebut
+struct AdcFrame {
+    float raw[ADC_CHANNEL_COUNT];
+    float filtered[ADC_CHANNEL_COUNT];
+    uint16_t samples[ADC_CHANNEL_COUNT];  // jumlah sample yang dirata-rata, 0 = channel tidak di-DMA
+    uint32_t sequence;
+    int64_t timestampMicros;              // esp_timer_get_time() di akhir window frame
+};
+
+/**
+ * @brief Sampling ADC kontinu (DMA) di background untuk channel analog
+ *
+ * ADC digital controller mengisi ring buffer DMA dengan cadence tetap
+ * (Config::ADC_SAMPLE_RATE_HZ untuk semua channel). Task di core 0
+ * mengosongkan ring tersebut, menjumlahkan per channel, dan setiap
+ * Config::ADC_FRAME_SAMPLES sample mem-publish rata-ratanya sebagai
+ * AdcFrame lewat seqlock. Setiap frame juga melewati FilterBank per
+ * channel (median, IIR, rate limiter) di task yang sama, jadi filter
+ * berjalan di rate frame, bukan di rate update SensorManager.
+ * SensorManager cukup membaca frame terbaru, tanpa analogRead dan tanpa
+ * busy-wait.
+ *
+ * Continuous mode ESP32 hanya mendukung ADC1 (GPIO 32-39). AFR, MAP dan
+ * TPS dipastikan di ADC1 saat compile; channel lain di pin ADC2 atau pin
+ * tidak valid tidak di-DMA (samples = 0) dan caller kembali ke analogRead.
+ */
+class AdcSampler {
+private:
+    TaskHandle_t taskHandle;
+    int adcChannel[ADC_CHANNEL_COUNT];  // channel ADC1 per AdcChannel, -1 = tidak di-DMA
+    int activeChannels;
+    SeqlockSnapshot<AdcFrame> frameSnapshot;
+    uint32_t overruns;
+    // Hanya dipakai task sampler setelah start()
+    FilterBank<ADC_CHANNEL_COUNT, Config::ADC_FILTER_MAX_MEDIAN> filters;
+
+    static void taskEntry(void* parameter);
+    void run();
+    void publishFrame(uint32_t (&sums)[ADC_CHANNEL_COUNT], uint16_t (&counts)[ADC_CHANNEL_COUNT], AdcFrame& frame);
+
+public:
+    AdcSampler();
+    ~AdcSampler();
+
+    // pins[AdcChannel] dari Config; false jika tidak ada channel ADC1 atau driver gagal
+    bool start(const int (&pins)[ADC_CHANNEL_COUNT]);
+    bool isRunning() const { return taskHandle != nullptr; }
+    bool isSampled(AdcChannel channel) const { return adcChannel[int(channel)] >= 0 && isRunning(); }
+
+    bool getLatestFrame(AdcFrame& frame) const { return frameSnapshot.read(frame); }
+    uint32_t getOverruns() const { return overruns; }
+    const ChannelFilterConfig& getFilterConfig(AdcChannel channel) const { return filters.getConfig(int(channel)); }
+
+    static AdcSampler& getInstance() {
+        static AdcSampler instance;
+        return instance;
+    }
+};
+
+#endif // ADC_SAMPLER_H
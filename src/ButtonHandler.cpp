@@ -224,6 +224,9 @@ void ButtonHandler::update() {
                     } else {
                         Serial.println("ERROR: SELECT menu entry failed");
                     }
+                } else if (currentStatus == SystemStatus::RECORDING) {
+                    // Tandai kondisi saat ini sebagai contoh berlabel (mis. false alarm = Normal)
+                    system.learnCurrentSample(Config::LEARN_BUTTON_LABEL);
                 } else {
                     Serial.printf("SELECT: No action - Status: %d\n", static_cast<int>(currentStatus));
                 }
@@ -0,0 +1,108 @@
+#ifndef CHANNEL_SCHEDULER_H
+#define CHANNEL_SCHEDULER_H
+
+#include <stdint.h>
+
+// ChannelScheduler.h
+// Jadwal akuisisi per channel: setiap channel punya periode per mode
+// (IDLE, RECORDING, CRITICAL) dan prioritas. due() dipanggil setiap loop
+// dan mengembalikan bitmask channel yang jatuh tempo, maksimal
+// maxChannels per tick dengan prioritas tertinggi (0) dan yang paling
+// terlambat lebih dulu; sisanya ditunda ke tick berikutnya (deferred).
+// Ganti mode langsung berlaku: channel yang sudah lewat periode barunya
+// jatuh tempo di tick berikutnya. Tidak bergantung pada Arduino.
+
+enum class ScheduleMode : uint8_t {
+    IDLE = 0,       // tidak recording: rate minimum
+    RECORDING = 1,  // recording: rate penuh untuk channel dinamis
+    CRITICAL = 2    // klasifikasi Critical: rate maksimum
+};
+
+static constexpr int SCHEDULE_MODE_COUNT = 3;
+
+struct ChannelSchedule {
+    uint16_t periodMs[SCHEDULE_MODE_COUNT];  // per ScheduleMode, 0 = channel tidak dibaca di mode itu
+    uint8_t priority;                        // 0 = tertinggi
+};
+
+template <int N>
+class ChannelScheduler {
+public:
+    static_assert(N >= 1 && N <= 32, "Bitmask channel 32-bit");
+
+    ChannelScheduler() : mode(ScheduleMode::IDLE) {
+        for (int c = 0; c < N; c++) {
+            schedules[c] = {{0, 0, 0}, 0};
+            lastRun[c] = 0;
+            runs[c] = 0;
+            deferred[c] = 0;
+            started[c] = false;
+        }
+    }
+
+    void configure(int channel, const ChannelSchedule& schedule) {
+        if (channel < 0 || channel >= N) return;
+        schedules[channel] = schedule;
+        started[channel] = false;
+    }
+
+    // Semua channel jatuh tempo di tick berikutnya (mis. setelah ganti sumber)
+    void restart() {
+        for (int c = 0; c < N; c++) started[c] = false;
+    }
+
+    void setMode(ScheduleMode next) { mode = next; }
+    ScheduleMode getMode() const { return mode; }
+
+    // Channel yang harus dibaca sekarang; yang terpilih dianggap sudah dilayani
+    uint32_t due(unsigned long nowMillis, int maxChannels) {
+        uint32_t candidates = 0;
+        for (int c = 0; c < N; c++) {
+            const uint16_t period = schedules[c].periodMs[int(mode)];
+            if (period == 0) continue;
+            if (!started[c] || nowMillis - lastRun[c] >= period) candidates |= 1u << c;
+        }
+
+        uint32_t selected = 0;
+        for (int picked = 0; candidates != 0 && picked < maxChannels; picked++) {
+            int best = -1;
+            for (int c = 0; c < N; c++) {
+                if (!(candidates & (1u << c))) continue;
+                if (best < 0 || schedules[c].priority < schedules[best].priority ||
+                    (schedules[c].priority == schedules[best].priority && overdue(c, nowMillis) > overdue(best, nowMillis))) {
+                    best = c;
+                }
+            }
+            candidates &= ~(1u << best);
+            selected |= 1u << best;
+            lastRun[best] = nowMillis;
+            started[best] = true;
+            runs[best]++;
+        }
+        for (int c = 0; c < N; c++) {
+            if (candidates & (1u << c)) deferred[c]++;
+        }
+        return selected;
+    }
+
+    uint16_t getPeriod(int channel) const { return schedules[channel].periodMs[int(mode)]; }
+    uint8_t getPriority(int channel) const { return schedules[channel].priority; }
+    uint32_t getRuns(int channel) const { return runs[channel]; }
+    uint32_t getDeferred(int channel) const { return deferred[channel]; }
+
+private:
+    ChannelSchedule schedules[N];
+    unsigned long lastRun[N];
+    uint32_t runs[N];
+    uint32_t deferred[N];
+    bool started[N];
+    ScheduleMode mode;
+
+    // Keterlambatan relatif terhadap periode (ms); channel baru dianggap paling terlambat
+    unsigned long overdue(int channel, unsigned long nowMillis) const {
+        if (!started[channel]) return ~0UL;
+        return nowMillis - lastRun[channel] - schedules[channel].periodMs[int(mode)];
+    }
+};
+
+#endif // CHANNEL_SCHEDULER_H
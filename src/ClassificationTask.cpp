@@ -0,0 +1,99 @@
+#include "ClassificationTask.h"
+
+ClassificationTask::ClassificationTask()
+    : classifier(nullptr), taskHandle(nullptr), classifierMutex(nullptr) {
+}
+
+ClassificationTask::~ClassificationTask() {
+    if (taskHandle) {
+        vTaskDelete(taskHandle);
+        taskHandle = nullptr;
+    }
+    if (classifierMutex) {
+        vSemaphoreDelete(classifierMutex);
+        classifierMutex = nullptr;
+    }
+}
+
+bool ClassificationTask::start(KNNClassifier* knnClassifier) {
+    if (taskHandle) return true;
+    classifier = knnClassifier;
+
+    classifierMutex = xSemaphoreCreateMutex();
+    if (!classifierMutex) {
+        Serial.println("ERROR: Cannot create classifier mutex");
+        return false;
+    }
+
+    // Loop Arduino jalan di ARDUINO_RUNNING_CORE (core 1), task KNN di core 0
+    BaseType_t created = xTaskCreatePinnedToCore(taskEntry, "knn_classify", Config::CLASSIFICATION_TASK_STACK,
+                                                 this, Config::CLASSIFICATION_TASK_PRIORITY, &taskHandle,
+                                                 Config::CLASSIFICATION_TASK_CORE);
+    if (created != pdPASS) {
+        taskHandle = nullptr;
+        vSemaphoreDelete(classifierMutex);
+        classifierMutex = nullptr;
+        Serial.println("ERROR: Cannot create classification task");
+        return false;
+    }
+
+    Serial.printf("Classification task started on core %d (stack %d bytes, priority %d)\n",
+                  Config::CLASSIFICATION_TASK_CORE, Config::CLASSIFICATION_TASK_STACK,
+                  Config::CLASSIFICATION_TASK_PRIORITY);
+    return true;
+}
+
+void ClassificationTask::taskEntry(void* parameter) {
+    static_cast<ClassificationTask*>(parameter)->run();
+}
+
+void ClassificationTask::run() {
+    uint32_t lastVersion = 0;
+
+    for (;;) {
+        // Tidur sampai main loop submit snapshot baru
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Read gagal jika main loop ter-preempt di tengah publish: beri 1 tick
+        // supaya publish selesai, ulang terbatas agar sample tidak hilang
+        ClassificationResult result;
+        uint32_t version = 0;
+        bool fresh = inputSnapshot.read(result.input, &version);
+        for (int retry = 0; !fresh && retry < Config::CLASSIFICATION_READ_RETRIES; retry++) {
+            vTaskDelay(1);
+            fresh = inputSnapshot.read(result.input, &version);
+        }
+        if (!fresh || version == lastVersion) {
+            continue;
+        }
+        lastVersion = version;
+
+        xSemaphoreTake(classifierMutex, portMAX_DELAY);
+        unsigned long start = micros();
+        result.classification = classifier->classify(result.input);
+        result.executionMicros = micros() - start;
+        xSemaphoreGive(classifierMutex);
+
+        result.inputVersion = version;
+        resultSnapshot.publish(result);
+    }
+}
+
+void ClassificationTask::submit(const SensorData& data) {
+    inputSnapshot.publish(data);
+    if (taskHandle) {
+        xTaskNotifyGive(taskHandle);
+    }
+}
+
+void ClassificationTask::lockClassifier() {
+    if (classifierMutex) {
+        xSemaphoreTake(classifierMutex, portMAX_DELAY);
+    }
+}
+
+void ClassificationTask::unlockClassifier() {
+    if (classifierMutex) {
+        xSemaphoreGive(classifierMutex);
+    }
+}
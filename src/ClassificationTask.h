@@ -0,0 +1,65 @@
+#ifndef CLASSIFICATION_TASK_H
+#define CLASSIFICATION_TASK_H
+
+#include "DataStructures.h"
+#include "KNNClassifier.h"
+#include "SeqlockSnapshot.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+// Hasil klasifikasi yang dipublish task KNN ke main loop
+struct ClassificationResult {
+    int classification;
+    uint32_t executionMicros;   // waktu classify() di task
+    uint32_t inputVersion;      // versi snapshot SensorData yang diklasifikasi
+    SensorData input;           // snapshot yang diklasifikasi (untuk log)
+};
+
+/**
+ * @brief KNN inference di FreeRTOS task pada core lain dari loop Arduino
+ *
+ * Main loop mem-publish snapshot SensorData dan membaca hasil terbaru,
+ * keduanya lewat seqlock (tanpa lock, tidak pernah menunggu task). Mutex
+ * hanya dipakai untuk perintah yang mengubah classifier (backend, cache,
+ * model) supaya tidak terjadi di tengah klasifikasi.
+ */
+class ClassificationTask {
+private:
+    KNNClassifier* classifier;
+    TaskHandle_t taskHandle;
+    SemaphoreHandle_t classifierMutex;
+    SeqlockSnapshot<SensorData> inputSnapshot;
+    SeqlockSnapshot<ClassificationResult> resultSnapshot;
+
+    static void taskEntry(void* parameter);
+    void run();
+
+public:
+    ClassificationTask();
+    ~ClassificationTask();
+
+    bool start(KNNClassifier* knnClassifier);
+    bool isRunning() const { return taskHandle != nullptr; }
+    // Sisa stack minimum task sejak start (bytes), 0 jika belum jalan
+    uint32_t getStackHighWaterMark() const {
+        return taskHandle ? uxTaskGetStackHighWaterMark(taskHandle) : 0;
+    }
+
+    // Dipanggil dari main loop
+    void submit(const SensorData& data);
+    bool getLatestResult(ClassificationResult& result, uint32_t* version = nullptr) const {
+        return resultSnapshot.read(result, version);
+    }
+
+    // Serialisasi perubahan konfigurasi classifier dengan task
+    void lockClassifier();
+    void unlockClassifier();
+
+    static ClassificationTask& getInstance() {
+        static ClassificationTask instance;
+        return instance;
+    }
+};
+
+#endif // CLASSIFICATION_TASK_H
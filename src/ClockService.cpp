@@ -0,0 +1,132 @@
+#include "ClockService.h"
+#include "GpsReceiver.h"
+#include <esp_timer.h>
+
+ClockService* ClockService::instance = nullptr;
+
+ClockService::ClockService()
+    : discipline(Config::CLOCK_STEP_THRESHOLD_US, Config::CLOCK_RATE_MIN_BASELINE_US, Config::CLOCK_RATE_WINDOW_US,
+                 Config::CLOCK_MAX_RATE_PPB),
+      lastFixSequence(0), lastEpochUtc(0), lastSyncMicros(0), lastSyncPps(false), lastPpsCount(0),
+      measuredNmeaLatency(0), ppsMicros(0), ppsCount(0) {
+}
+
+// Interrupt handler PPS: hanya mencatat waktu edge
+void IRAM_ATTR ClockService::ppsInterruptHandler() {
+    if (instance) {
+        instance->ppsMicros = esp_timer_get_time();
+        instance->ppsCount.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void ClockService::begin() {
+    instance = this;
+    if (Config::GPS_PPS_PIN >= 0) {
+        pinMode(Config::GPS_PPS_PIN, INPUT);
+        attachInterrupt(digitalPinToInterrupt(Config::GPS_PPS_PIN), ppsInterruptHandler, RISING);
+        Serial.printf("Clock: GPS PPS on pin %d\n", Config::GPS_PPS_PIN);
+    } else {
+        Serial.println("Clock: no PPS - disciplining from NMEA arrival");
+    }
+}
+
+bool ClockService::readPpsEdge(int64_t& edgeMicros, uint32_t& count) const {
+    // ISR bisa masuk di tengah salinan 64-bit: ulang jika count berubah
+    for (int attempt = 0; attempt < 4; attempt++) {
+        count = ppsCount.load(std::memory_order_acquire);
+        edgeMicros = ppsMicros;
+        if (ppsCount.load(std::memory_order_acquire) == count) {
+            return count > 0;
+        }
+    }
+    return false;
+}
+
+void ClockService::update() {
+    GpsFix fix;
+    if (!GpsReceiver::getInstance().getLatestFix(fix) || fix.sequence == lastFixSequence) {
+        return;
+    }
+    lastFixSequence = fix.sequence;
+
+    // Satu pengukuran per detik GPS: epoch di detik penuh, sekali per epoch (RMC + GGA)
+    if (!fix.timeValid || fix.utcTime % 100 != 0) {
+        return;
+    }
+    const int64_t utc = gpsUtcToUnixMicros(fix.utcDate, fix.utcTime);
+    if (utc == 0 || utc == lastEpochUtc) {
+        return;
+    }
+    lastEpochUtc = utc;
+
+    // Edge PPS menandai awal detik yang dilaporkan NMEA sesudahnya
+    int64_t edge;
+    uint32_t count;
+    if (readPpsEdge(edge, count) && count != lastPpsCount && fix.arrivalMicros >= edge &&
+        fix.arrivalMicros - edge < 1000000) {
+        lastPpsCount = count;
+        measuredNmeaLatency = fix.arrivalMicros - edge;  // nilai untuk CLOCK_NMEA_LATENCY_US
+        discipline.discipline(edge, utc, true);
+        lastSyncMicros = edge;
+        lastSyncPps = true;
+    } else if (!lastSyncPps || fix.arrivalMicros - lastSyncMicros > 2000000) {
+        // Tanpa PPS (atau PPS hilang > 2 s): jitter NMEA ms, tetap lebih baik dari uptime
+        const int64_t epochLocal = fix.arrivalMicros - Config::CLOCK_NMEA_LATENCY_US;
+        discipline.discipline(epochLocal, utc, false);
+        lastSyncMicros = epochLocal;
+        lastSyncPps = false;
+    } else {
+        return;
+    }
+    modelSnapshot.publish(discipline.getModel());
+}
+
+int64_t ClockService::toUtcMicros(int64_t localMicros) const {
+    GpsClockModel model;
+    if (!modelSnapshot.read(model)) {
+        return 0;
+    }
+    return gpsClockToUtc(model, localMicros);
+}
+
+int64_t ClockService::nowUtcMicros() const {
+    return toUtcMicros(esp_timer_get_time());
+}
+
+bool ClockService::isLocked() const {
+    return isSynced() && esp_timer_get_time() - lastSyncMicros < Config::CLOCK_HOLDOVER_US;
+}
+
+const char* ClockService::getStateText() const {
+    if (!isSynced()) return "UNSYNCED";
+    // Sinkron NMEA tanpa latency terukur: semua stamp UTC terlambat sebesar latency output receiver
+    const bool uncorrected = !lastSyncPps && Config::CLOCK_NMEA_LATENCY_US == 0;
+    if (!isLocked()) return uncorrected ? "HOLDOVER NMEA (latency uncorrected)" : "HOLDOVER";
+    if (lastSyncPps) return "LOCKED PPS";
+    return uncorrected ? "LOCKED NMEA (latency uncorrected)" : "LOCKED NMEA";
+}
+
+void ClockService::formatNow(char* buffer, size_t size) const {
+    const int64_t now = nowUtcMicros();
+    if (now == 0) {
+        snprintf(buffer, size, "-");
+        return;
+    }
+    formatUtcMicros(now, buffer, size);
+}
+
+void ClockService::printStatus() const {
+    char now[32];
+    formatNow(now, sizeof(now));
+    Serial.printf("Clock: %s, UTC %s\n", getStateText(), now);
+    if (isSynced()) {
+        Serial.printf("Clock sync: %u updates, %u steps, last error %lld us, rate %.3f ppm, last sync %lld ms ago\n",
+                      (unsigned)discipline.getUpdates(), (unsigned)discipline.getSteps(),
+                      (long long)discipline.getLastError(), discipline.getModel().ratePpb / 1000.0f,
+                      (long long)((esp_timer_get_time() - lastSyncMicros) / 1000));
+    }
+    if (measuredNmeaLatency != 0) {
+        Serial.printf("Clock NMEA latency: %lld us after PPS (Config::CLOCK_NMEA_LATENCY_US = %lld)\n",
+                      (long long)measuredNmeaLatency, (long long)Config::CLOCK_NMEA_LATENCY_US);
+    }
+}
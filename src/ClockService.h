@@ -0,0 +1,64 @@
+#ifndef CLOCK_SERVICE_H
+#define CLOCK_SERVICE_H
+
+#include "Config.h"
+#include "GpsClock.h"
+#include "SeqlockSnapshot.h"
+#include <atomic>
+
+/**
+ * @brief Jam UTC absolut yang dikunci ke GPS
+ *
+ * Timer lokal esp_timer (us, monotonic) dipetakan ke UTC oleh
+ * GpsClockDiscipline. Satu pengukuran per detik GPS: edge PPS
+ * (Config::GPS_PPS_PIN, presisi us) jika terhubung dan segar, selain itu
+ * kedatangan sentence NMEA dikurangi Config::CLOCK_NMEA_LATENCY_US.
+ * update() dipanggil dari loop; nowUtcMicros()/toUtcMicros() hanya membaca
+ * model lewat seqlock, aman dari core mana pun. Sebelum sinkron pertama
+ * keduanya mengembalikan 0; setelah GPS hilang jam tetap berjalan dengan
+ * rate terakhir (holdover).
+ */
+class ClockService {
+private:
+    GpsClockDiscipline discipline;
+    SeqlockSnapshot<GpsClockModel> modelSnapshot;
+    uint32_t lastFixSequence;
+    int64_t lastEpochUtc;
+    int64_t lastSyncMicros;        // waktu lokal pengukuran terakhir
+    bool lastSyncPps;
+    uint32_t lastPpsCount;
+    int64_t measuredNmeaLatency;   // kedatangan NMEA - edge PPS terakhir, 0 = belum ada PPS
+
+    // Edge PPS terakhir dari ISR: count dinaikkan setelah waktu ditulis
+    volatile int64_t ppsMicros;
+    std::atomic<uint32_t> ppsCount;
+
+    static ClockService* instance;
+    static void IRAM_ATTR ppsInterruptHandler();
+    bool readPpsEdge(int64_t& edgeMicros, uint32_t& count) const;
+
+public:
+    ClockService();
+
+    void begin();
+    void update();
+
+    // us sejak 1970-01-01 UTC, 0 jika belum pernah sinkron
+    int64_t nowUtcMicros() const;
+    int64_t toUtcMicros(int64_t localMicros) const;
+
+    bool isSynced() const { return discipline.getModel().synced; }
+    bool isLocked() const;                       // sinkron dan belum lewat CLOCK_HOLDOVER_US
+    // UNSYNCED / LOCKED PPS / LOCKED NMEA / HOLDOVER; sinkron NMEA dengan
+    // CLOCK_NMEA_LATENCY_US = 0 diberi akhiran "(latency uncorrected)"
+    const char* getStateText() const;
+    void formatNow(char* buffer, size_t size) const;  // ISO 8601, atau "-" jika belum sinkron
+    void printStatus() const;
+
+    static ClockService& getInstance() {
+        static ClockService clock;
+        return clock;
+    }
+};
+
+#endif // CLOCK_SERVICE_H
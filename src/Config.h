@@ -36,6 +36,42 @@ public:
   static const int K_VALUE = 3;
   static const int NUM_CLASSES = 4; // Updated to 4 classes
 
+  // Classification cache: noise floor per channel. Perubahan lebih kecil dari
+  // ini dianggap noise dan memakai hasil klasifikasi sebelumnya.
+  // Hanya tahap KNN yang di-cache (rules hybrid dievaluasi dulu), jadi bucket boleh memotong rule.
+  static const int CLASSIFICATION_CACHE_SLOTS = 16;
+  static constexpr float NOISE_FLOOR_AFR = 0.1f;   // AFR
+  static constexpr float NOISE_FLOOR_RPM = 50.0f;  // RPM
+  static constexpr float NOISE_FLOOR_TEMP = 0.5f;  // °C
+  static constexpr float NOISE_FLOOR_TPS = 0.5f;   // %
+  static constexpr float NOISE_FLOOR_MAP = 1.0f;   // kPa
+  static constexpr float NOISE_FLOOR_INCLINE = 0.5f; // ° (model 7 feature)
+  static constexpr float NOISE_FLOOR_STROKE = 0.5f;  // mm (model 7 feature)
+
+  // BENCH_AI: jumlah klasifikasi per backend (default dan maksimum)
+  static const int BENCH_AI_RUNS = 1000;
+  static const int BENCH_AI_MAX_RUNS = 10000;
+
+  // AI_RELABEL: baris rekaman yang dibaca per loop (klasifikasi per blok KNN_BATCH_BLOCK)
+  static const int AI_RELABEL_LINES_PER_LOOP = 32;
+
+  // Online learning: sample berlabel dari lintasan (AI_LEARN / tombol SELECT
+  // saat recording), di-scan bersama training set dan disimpan di SPIFFS
+  static const int ONLINE_SAMPLE_CAPACITY = 64;
+  static constexpr const char* KNN_ONLINE_FILE = "/knn_online.bin";
+  static const int LEARN_BUTTON_LABEL = 0; // SELECT saat recording = "kondisi ini normal"
+
+  // Task klasifikasi KNN (FreeRTOS), di core yang tidak dipakai loop Arduino
+  static const int CLASSIFICATION_TASK_CORE = 0;
+  static const int CLASSIFICATION_TASK_STACK = 4096; // bytes
+  static const int CLASSIFICATION_TASK_PRIORITY = 1;
+  static const int CLASSIFICATION_READ_RETRIES = 3;  // read snapshot gagal: ulang tiap 1 tick
+
+  // Model KNN biner (tools/knn_model_pack.cpp) di SPIFFS. Jika tidak ada
+  // atau tidak valid, classifier memakai model yang di-compile.
+  static constexpr const char* KNN_MODEL_FILE = "/knn_model.bin";
+  static const size_t KNN_MODEL_FILE_MAX_BYTES = 64 * 1024;
+
   // Classification thresholds for hybrid approach
   const float COLD_ENGINE_THRESHOLD = 65.0; // °C
   const float WARM_ENGINE_THRESHOLD = 75.0; // °C
@@ -61,7 +97,9 @@ public:
   static const int GPS_RX = 16;
   static const int GPS_TX = 17;
 
-  static const int PIN_AFR = 26;
+  // AFR/MAP/TPS wajib di pin ADC1 (GPIO 32-39): ikut sampling DMA AdcSampler,
+  // dan ADC2 tidak bisa dibaca selama WiFi aktif
+  static const int PIN_AFR = 34;
   static const int PIN_MAP = 35;
   static const int PIN_TPS = 32;
   static const int PIN_INCLINE = 15;
@@ -76,7 +114,7 @@ public:
 
   static const int BTN_CURSOR = 36;
   static const int BTN_TX = 39;
-  static const int LED_PIN = 34;
+  static const int LED_PIN = -1;  // tidak terpasang (GPIO34 input-only, dipakai AFR)
   // Timing Constants
   // Timing Constants - UPDATED
   static const int BTN_REC = 21;                      // Pin 15 untuk RECORDING (khusus)
@@ -84,13 +122,85 @@ public:
   static const unsigned long MENU_PRESS_TIME = 100;   // 1s untuk masuk menu
   static const unsigned long RECORD_PRESS_TIME = 100; // 3s untuk recording
   static const unsigned long SHORT_PRESS_TIME = 10;   // Minimum press detection
-  static const unsigned long SENSOR_UPDATE_INTERVAL = 100;
-  static const unsigned long GPS_UPDATE_INTERVAL = 300;
+  // File rekaman yang diputar ulang oleh SENSOR_SOURCE REPLAY (format TelemetryLog.h)
+  static constexpr const char* SENSOR_REPLAY_FILE = "/telemetry_data.txt";
+  // Kurva kalibrasi per motor ("<CHANNEL> <raw> <value>" per baris, SensorCalibration.h)
+  static constexpr const char* SENSOR_CALIBRATION_FILE = "/calibration.txt";
+  // Stream SensorData untuk consumer (pangkat dua): 64 sample = 1.3 s pada rate recording 50 ms
+  static const int SENSOR_SAMPLE_RING_SIZE = 64;
+
+  // Jadwal akuisisi per channel (ms), urutan SensorChannel:
+  // AFR, RPM, TEMP, TPS, MAP, INCLINE, STROKE, GPS. Prioritas 0 = tertinggi.
+  // Periode 0 = tidak dijadwalkan: INCLINE/STROKE belum terpasang,
+  // jadi tidak memakan slot SENSOR_CHANNELS_PER_TICK. Isi periode saat sensornya dipasang.
+  static constexpr uint16_t SENSOR_PERIOD_IDLE_MS[8] = {200, 100, 2000, 100, 200, 0, 0, 200};
+  static constexpr uint16_t SENSOR_PERIOD_RECORDING_MS[8] = {50, 50, 1000, 50, 50, 0, 0, 100};
+  static constexpr uint16_t SENSOR_PERIOD_CRITICAL_MS[8] = {20, 20, 750, 20, 20, 0, 0, 100};
+  static constexpr uint8_t SENSOR_PRIORITY[8] = {1, 0, 4, 0, 1, 3, 3, 2};
+  static const int SENSOR_CHANNELS_PER_TICK = 4;   // sisa channel jatuh tempo ditunda ke loop berikutnya
   static const unsigned long COOLING_UPDATE_INTERVAL = 100;
   static const unsigned long CLASSIFICATION_INTERVAL = 100;
   static const unsigned long HEALTH_CHECK_INTERVAL = 100;
   static const unsigned long RESPONSIVE_PRESS_TIME = 10; // 0.1s untuk RESPONSIVE_PRESS_TIME
 
+  // ADC kontinu (DMA, hanya pin ADC1): rate total semua channel, minimum ESP32 20 kHz.
+  // Satu frame = rata-rata ADC_FRAME_SAMPLES sample (20 kHz / 200 = frame 100 Hz)
+  static const int ADC_SAMPLE_RATE_HZ = 20000;
+  static const int ADC_FRAME_SAMPLES = 200;
+  static const int ADC_READ_BYTES = 400;        // satu blok DMA = satu frame (2 byte per sample, kelipatan 4)
+  static const int ADC_DMA_BUFFER_BYTES = 2048; // ring buffer driver
+  static const int ADC_TASK_CORE = 0;
+  static const int ADC_TASK_STACK = 3072;       // bytes
+  static const int ADC_TASK_PRIORITY = 2;
+  // Filter bank per channel di rate frame ADC, urutan AdcChannel (AFR, MAP, TPS, INCLINE, STROKE).
+  // Median ganjil <= ADC_FILTER_MAX_MEDIAN (1 = mati), tau IIR 0 = mati, rate limit 0 = mati.
+  // Rate limit TPS: buka penuh (~2700 code, 1.2-4.5 V) paling cepat ~0.1 s dengan tangan,
+  // jadi 30000 code/s tidak memotong gerakan asli tapi menahan glitch konektor multi-frame
+  // yang lolos median. Channel di luar ADC1 (INCLINE GPIO15) di-sample di rate frame yang
+  // sama dari HardwareSensorSource::poll(), dengan filter yang sama.
+  static const int ADC_FILTER_MAX_MEDIAN = 5;
+  static constexpr uint8_t ADC_FILTER_MEDIAN_TAPS[5] = {3, 3, 3, 5, 3};
+  static constexpr float ADC_FILTER_TAU_S[5] = {0.05f, 0.02f, 0.02f, 0.1f, 0.0f};
+  static constexpr float ADC_FILTER_MAX_CODES_PER_S[5] = {0.0f, 0.0f, 30000.0f, 0.0f, 0.0f};
+
+  // GPS: UART event task, receiver dikonfigurasi ke GPS_BAUD / GPS_RATE_HZ saat boot
+  // (protokol lewat build flag, lihat GpsReceiver.h)
+  static const int GPS_UART_NUM = 2;
+  static const uint32_t GPS_BAUD_DEFAULT = 9600;   // baud pabrik receiver
+  static const uint32_t GPS_BAUD = 115200;
+  static const int GPS_RATE_HZ = 10;
+  static const int GPS_RX_BUFFER = 2048;           // ring buffer driver UART
+  static const int GPS_EVENT_QUEUE = 16;
+  static const unsigned long GPS_DETECT_TIMEOUT_MS = 3000; // tanpa NMEA valid -> kembali ke baud default
+  static const unsigned long GPS_FIX_STALE_MS = 2000;      // fix lebih tua dianggap tidak valid
+  static const int GPS_TASK_CORE = 0;
+  static const int GPS_TASK_STACK = 4096;           // bytes
+  static const int GPS_TASK_PRIORITY = 3;
+
+  // Jam UTC dari GPS (ClockService): PPS jika terhubung, selain itu kedatangan NMEA
+  static const int GPS_PPS_PIN = -1;                        // -1 = PPS tidak terhubung
+  // Jeda epoch -> byte pertama NMEA, tergantung receiver/baud (puluhan-ratusan ms).
+  // 0 = belum diukur: status jam "(latency uncorrected)". Ukur dengan PPS terhubung
+  // (perintah GPS menampilkan "Clock NMEA latency") lalu isi di sini.
+  static const int64_t CLOCK_NMEA_LATENCY_US = 0;
+  static const int64_t CLOCK_STEP_THRESHOLD_US = 250000;    // error lebih besar -> step, bukan slew
+  static const int64_t CLOCK_RATE_MIN_BASELINE_US = 30000000;
+  static const int64_t CLOCK_RATE_WINDOW_US = 600000000;
+  static const int32_t CLOCK_MAX_RATE_PPB = 200000;         // +-200 ppm
+  static const int64_t CLOCK_HOLDOVER_US = 300000000;       // tanpa sinkron lebih lama -> status HOLDOVER
+
+  // RPM dari periode pulse (timestamp edge di ISR, dihitung saat dibaca)
+  static const int RPM_PULSES_PER_REV = 1;
+  static const int RPM_EDGE_RING_SIZE = 16;                    // pangkat dua
+  static const int RPM_AVERAGE_PULSES = 4;                     // periode yang dirata-rata
+  static const unsigned long RPM_AVERAGE_WINDOW_US = 100000;   // hanya edge 100 ms terakhir
+  static const unsigned long RPM_TIMEOUT_US = 500000;          // tanpa edge 0.5 s = mesin mati
+  static constexpr float RPM_MIN = 200.0f;                     // di bawah ini dianggap 0
+  static constexpr float RPM_MAX = 16000.0f;
+
+  // DS18B20: konversi async; jika belum selesai setelah waktu konversi + ini, dianggap error
+  static const unsigned long TEMP_CONVERSION_TIMEOUT_MS = 250;
+
   // Temperature Settings
   static constexpr float DEFAULT_FAN_TEMP = 80.0f;
   static constexpr float DEFAULT_CUTOFF_TEMP = 120.0f;
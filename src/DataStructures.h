@@ -93,16 +93,18 @@ struct SensorData {
     float speed;
     float incline;
     float stroke;
-    unsigned long timestamp;
+    int64_t timestampMicros;  // esp_timer_get_time() saat akuisisi
+    int64_t utcMicros;        // waktu yang sama dalam UTC (ClockService), 0 = jam belum sinkron
+    uint32_t channels;        // bit SensorChannel yang dibaca untuk sample ini; sisanya nilai lama
     
     SensorData() : lapNumber(0), afr(0), rpm(0), temp(0), tps(0), map_value(0),
-                   lat(0), lng(0), speed(0), incline(0), stroke(0), timestamp(0) {}
+                   lat(0), lng(0), speed(0), incline(0), stroke(0), timestampMicros(0), utcMicros(0), channels(0) {}
     
     String toCSV() const {
         return String(lapNumber) + "," + String(afr, 1) + "," + String(rpm, 0) + "," +
                String(temp, 1) + "," + String(tps, 1) + "," + String(map_value, 1) + "," +
                String(lat, 6) + "," + String(lng, 6) + "," + String(speed, 1) + "," +
-               String(incline, 1) + "," + String(stroke, 1) + "," + String(timestamp);
+               String(incline, 1) + "," + String(stroke, 1) + "," + String(timestampMicros) + "," + String(utcMicros);
     }
 };
 
@@ -146,12 +148,4 @@ struct LapStatistics {
     }
 };
 
-struct Distance {
-    float distance;
-    int classification;
-    
-    Distance() : distance(0), classification(0) {}
-    Distance(float d, int c) : distance(d), classification(c) {}
-};
-
 #endif // DATA_STRUCTURES_H
@@ -289,7 +289,7 @@ void DisplayManager::drawMainDisplay()
     
     // Check for significant data changes
     String currentClassificationText = system.getClassificationText();
-    float currentTemp = sensors.readTemperatureSensor();
+    float currentTemp = sensors.getCurrentTemperature();
     bool currentGPSValid = sensors.isGPSValid();
     
     bool dataChanged = (currentClassificationText != lastClassificationText) ||
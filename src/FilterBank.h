@@ -0,0 +1,119 @@
+#ifndef FILTER_BANK_H
+#define FILTER_BANK_H
+
+#include <stdint.h>
+
+// FilterBank.h
+// Filter digital per channel dalam fixed point, dipanggil sekali per sample
+// di rate akuisisi (frame AdcSampler, 100 Hz). Urutan stage per channel:
+//   median-of-N (buang spike) -> IIR low-pass orde 1 -> rate limiter
+// Input/output dalam code ADC Q4 (code x 16, sisa pecahan dari rata-rata
+// frame); state IIR Q16 supaya alpha kecil tidak kehilangan resolusi.
+// Ukuran (jumlah channel, tap median maksimum) ditentukan saat compile,
+// tidak ada alokasi. Tidak bergantung pada Arduino.
+
+static constexpr int FILTER_INPUT_SHIFT = 4;   // Q4
+static constexpr int32_t FILTER_ALPHA_ONE = 32768;  // alpha Q15, 1.0 = IIR mati
+
+struct ChannelFilterConfig {
+    uint8_t medianTaps;   // 1 = mati, ganjil
+    int32_t alpha;        // Q15: y += alpha * (x - y)
+    int32_t maxStep;      // perubahan output maksimum per sample (Q4), 0 = mati
+};
+
+template <int CHANNELS, int MAX_MEDIAN>
+class FilterBank {
+public:
+    static_assert(MAX_MEDIAN >= 1 && (MAX_MEDIAN & 1) == 1, "MAX_MEDIAN harus ganjil");
+
+    FilterBank() {
+        for (int c = 0; c < CHANNELS; c++) {
+            configs[c] = {1, FILTER_ALPHA_ONE, 0};
+            states[c].primed = false;
+        }
+    }
+
+    // false jika konfigurasi di luar ukuran compile-time (channel tidak diubah)
+    bool configure(int channel, const ChannelFilterConfig& config) {
+        if (channel < 0 || channel >= CHANNELS) return false;
+        if (config.medianTaps < 1 || config.medianTaps > MAX_MEDIAN || (config.medianTaps & 1) == 0) return false;
+        if (config.alpha <= 0 || config.alpha > FILTER_ALPHA_ONE || config.maxStep < 0) return false;
+        configs[channel] = config;
+        states[channel].primed = false;
+        return true;
+    }
+
+    const ChannelFilterConfig& getConfig(int channel) const { return configs[channel]; }
+
+    // Satu sample (Q4) masuk, satu sample terfilter (Q4) keluar
+    int32_t process(int channel, int32_t sample) {
+        const ChannelFilterConfig& config = configs[channel];
+        State& state = states[channel];
+        if (!state.primed) {
+            // Sample pertama mengisi semua state: tidak ada ramp dari 0
+            for (int i = 0; i < MAX_MEDIAN; i++) state.history[i] = sample;
+            state.historyIndex = 0;
+            state.iir = sample << IIR_EXTRA_SHIFT;
+            state.output = sample;
+            state.primed = true;
+            return sample;
+        }
+
+        int32_t x = sample;
+        if (config.medianTaps > 1) {
+            state.history[state.historyIndex] = sample;
+            state.historyIndex = state.historyIndex + 1 < config.medianTaps ? state.historyIndex + 1 : 0;
+            x = median(state.history, config.medianTaps);
+        }
+
+        // IIR di Q16: selisih <= 2^28, produk 64-bit
+        const int32_t target = x << IIR_EXTRA_SHIFT;
+        state.iir += int32_t((int64_t(config.alpha) * (target - state.iir)) >> 15);
+        int32_t y = (state.iir + (1 << (IIR_EXTRA_SHIFT - 1))) >> IIR_EXTRA_SHIFT;
+
+        if (config.maxStep > 0) {
+            if (y > state.output + config.maxStep) y = state.output + config.maxStep;
+            if (y < state.output - config.maxStep) y = state.output - config.maxStep;
+        }
+        state.output = y;
+        return y;
+    }
+
+    void reset(int channel) { states[channel].primed = false; }
+
+private:
+    static constexpr int IIR_EXTRA_SHIFT = 12;  // Q4 -> Q16
+
+    struct State {
+        int32_t history[MAX_MEDIAN];
+        uint8_t historyIndex;
+        int32_t iir;
+        int32_t output;
+        bool primed;
+    };
+
+    ChannelFilterConfig configs[CHANNELS];
+    State states[CHANNELS];
+
+    // Insertion sort salinan kecil (N <= MAX_MEDIAN)
+    static int32_t median(const int32_t* values, int count) {
+        int32_t sorted[MAX_MEDIAN];
+        for (int i = 0; i < count; i++) {
+            int32_t v = values[i];
+            int j = i;
+            while (j > 0 && sorted[j - 1] > v) {
+                sorted[j] = sorted[j - 1];
+                j--;
+            }
+            sorted[j] = v;
+        }
+        return sorted[count / 2];
+    }
+};
+
+// Alpha Q15 untuk time constant tau pada sample rate tertentu (alpha ~ dt / (tau + dt))
+constexpr int32_t filterAlphaForTau(float tauSeconds, float sampleRateHz) {
+    return int32_t(FILTER_ALPHA_ONE * (1.0f / sampleRateHz) / (tauSeconds + 1.0f / sampleRateHz) + 0.5f);
+}
+
+#endif // FILTER_BANK_H
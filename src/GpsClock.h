@@ -0,0 +1,139 @@
+#ifndef GPS_CLOCK_H
+#define GPS_CLOCK_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// GpsClock.h
+// Jam UTC yang dikunci ke GPS: timer lokal 64-bit us (esp_timer) dipetakan
+// ke UTC lewat titik referensi + koreksi rate (ppb). Setiap pengukuran
+// (waktu lokal, waktu UTC) dari edge PPS atau kedatangan NMEA:
+//   - belum sinkron / error > stepThreshold -> step langsung ke pengukuran
+//   - selain itu fase dikoreksi sebagian (PPS 1/2, NMEA 1/8, jitter NMEA
+//     jauh lebih besar) dan rate diukur dari baseline panjang (anchor),
+//     dibobot dengan panjang baseline, jadi jitter hampir tidak masuk ke rate
+// Konversi (toUtc) cukup satu perkalian integer. Tidak bergantung pada
+// Arduino supaya bisa diuji di host.
+
+// Tanggal/jam TinyGPS (date ddmmyy, time hhmmsscc) -> us sejak 1970-01-01 UTC.
+// Return 0 jika field tidak masuk akal.
+inline int64_t gpsUtcToUnixMicros(uint32_t ddmmyy, uint32_t hhmmsscc) {
+    const int day = int(ddmmyy / 10000);
+    const int month = int(ddmmyy / 100 % 100);
+    const int year = 2000 + int(ddmmyy % 100);
+    const int hour = int(hhmmsscc / 1000000);
+    const int minute = int(hhmmsscc / 10000 % 100);
+    const int second = int(hhmmsscc / 100 % 100);
+    const int centi = int(hhmmsscc % 100);
+    if (day < 1 || day > 31 || month < 1 || month > 12 || hour > 23 || minute > 59 || second > 60) return 0;
+
+    // days_from_civil (kalender Gregorian proleptik)
+    const int y = month <= 2 ? year - 1 : year;
+    const int era = y / 400;
+    const int yoe = y - era * 400;
+    const int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    const int64_t days = int64_t(era) * 146097 + doe - 719468;
+
+    const int64_t seconds = days * 86400 + hour * 3600 + minute * 60 + second;
+    return seconds * 1000000 + int64_t(centi) * 10000;
+}
+
+// us sejak epoch -> "YYYY-MM-DDThh:mm:ss.uuuuuuZ" (buffer >= 28 byte)
+inline void formatUtcMicros(int64_t unixMicros, char* buffer, size_t size) {
+    const int64_t seconds = unixMicros / 1000000;
+    const int micros = int(unixMicros % 1000000);
+    const int64_t days = seconds / 86400;
+    const int secondOfDay = int(seconds % 86400);
+
+    // civil_from_days
+    const int64_t z = days + 719468;
+    const int64_t era = z / 146097;
+    const int doe = int(z - era * 146097);
+    const int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int mp = (5 * doy + 2) / 153;
+    const int day = doy - (153 * mp + 2) / 5 + 1;
+    const int month = mp < 10 ? mp + 3 : mp - 9;
+    const int year = int(yoe + era * 400) + (month <= 2 ? 1 : 0);
+
+    snprintf(buffer, size, "%04d-%02d-%02dT%02d:%02d:%02d.%06dZ", year, month, day, secondOfDay / 3600,
+             secondOfDay / 60 % 60, secondOfDay % 60, micros);
+}
+
+// Pemetaan lokal -> UTC; trivially copyable untuk SeqlockSnapshot
+struct GpsClockModel {
+    bool synced;
+    int64_t refLocal;   // us timer lokal di titik referensi
+    int64_t refUtc;     // us UTC di titik referensi
+    int32_t ratePpb;    // UTC maju (1 + ratePpb / 1e9) us per us lokal
+};
+
+// 0 jika belum pernah sinkron
+inline int64_t gpsClockToUtc(const GpsClockModel& model, int64_t localMicros) {
+    if (!model.synced) return 0;
+    const int64_t dt = localMicros - model.refLocal;
+    return model.refUtc + dt + dt * model.ratePpb / 1000000000;
+}
+
+class GpsClockDiscipline {
+public:
+    GpsClockDiscipline(int64_t stepThresholdMicros, int64_t rateMinBaselineMicros, int64_t rateWindowMicros,
+                       int32_t maxRatePpb)
+        : model{false, 0, 0, 0}, anchorLocal(0), anchorUtc(0), stepThreshold(stepThresholdMicros),
+          rateMinBaseline(rateMinBaselineMicros), rateWindow(rateWindowMicros), maxRate(maxRatePpb),
+          lastError(0), updates(0), steps(0) {}
+
+    // Satu pengukuran: precise = edge PPS, false = kedatangan NMEA
+    void discipline(int64_t localMicros, int64_t utcMicros, bool precise) {
+        updates++;
+        const int64_t predicted = gpsClockToUtc(model, localMicros);
+        lastError = model.synced ? utcMicros - predicted : 0;
+        if (!model.synced || lastError > stepThreshold || lastError < -stepThreshold) {
+            // Rate dipertahankan saat step: error besar berarti fase, bukan frekuensi
+            model.synced = true;
+            model.refLocal = anchorLocal = localMicros;
+            model.refUtc = anchorUtc = utcMicros;
+            steps++;
+            return;
+        }
+
+        const int64_t baseline = localMicros - anchorLocal;
+        if (baseline >= rateMinBaseline) {
+            // Bobot naik dengan baseline: pengukuran baseline pendek hanya menggeser sedikit
+            const int64_t measured = ((utcMicros - anchorUtc) - baseline) * 1000000000 / baseline;
+            const int64_t weight = baseline < rateWindow ? baseline : rateWindow;
+            int64_t rate = model.ratePpb + (measured - model.ratePpb) * weight / rateWindow;
+            if (rate > maxRate) rate = maxRate;
+            if (rate < -maxRate) rate = -maxRate;
+            model.ratePpb = int32_t(rate);
+        }
+
+        model.refUtc = predicted + (precise ? lastError / 2 : lastError / 8);
+        model.refLocal = localMicros;
+        if (baseline >= rateWindow) {
+            // Anchor baru dari fase yang sudah difilter
+            anchorLocal = model.refLocal;
+            anchorUtc = model.refUtc;
+        }
+    }
+
+    const GpsClockModel& getModel() const { return model; }
+    int64_t getLastError() const { return lastError; }  // us, sebelum koreksi
+    uint32_t getUpdates() const { return updates; }
+    uint32_t getSteps() const { return steps; }
+
+private:
+    GpsClockModel model;
+    int64_t anchorLocal;
+    int64_t anchorUtc;
+    int64_t stepThreshold;
+    int64_t rateMinBaseline;
+    int64_t rateWindow;
+    int32_t maxRate;
+    int64_t lastError;
+    uint32_t updates;
+    uint32_t steps;
+};
+
+#endif // GPS_CLOCK_H
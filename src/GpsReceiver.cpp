@@ -0,0 +1,226 @@
+#include "GpsReceiver.h"
+#include <driver/uart.h>
+#include <esp_timer.h>
+
+static const uart_port_t GPS_UART = uart_port_t(Config::GPS_UART_NUM);
+
+GpsReceiver::GpsReceiver()
+    : taskHandle(nullptr), uartQueue(nullptr), baudRate(Config::GPS_BAUD_DEFAULT), fixCount(0), overflows(0),
+      passedSentences(0), failedSentences(0) {
+}
+
+GpsReceiver::~GpsReceiver() {
+    if (taskHandle) {
+        vTaskDelete(taskHandle);
+        taskHandle = nullptr;
+        uart_driver_delete(GPS_UART);
+    }
+}
+
+bool GpsReceiver::start() {
+    if (taskHandle) return true;
+
+    uart_config_t uartConfig = {};
+    uartConfig.baud_rate = Config::GPS_BAUD_DEFAULT;
+    uartConfig.data_bits = UART_DATA_8_BITS;
+    uartConfig.parity = UART_PARITY_DISABLE;
+    uartConfig.stop_bits = UART_STOP_BITS_1;
+    uartConfig.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+    uartConfig.source_clk = UART_SCLK_APB;
+
+    if (uart_driver_install(GPS_UART, Config::GPS_RX_BUFFER, 0, Config::GPS_EVENT_QUEUE, &uartQueue, 0) != ESP_OK) {
+        Serial.println("ERROR: GPS UART driver install failed");
+        return false;
+    }
+    uart_param_config(GPS_UART, &uartConfig);
+    uart_set_pin(GPS_UART, Config::GPS_TX, Config::GPS_RX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+    // Event RX timeout setelah 2 karakter idle: sentence diproses segera setelah selesai
+    uart_set_rx_timeout(GPS_UART, 2);
+    baudRate = Config::GPS_BAUD_DEFAULT;
+
+    configureReceiver();
+
+    BaseType_t created = xTaskCreatePinnedToCore(taskEntry, "gps_uart", Config::GPS_TASK_STACK, this,
+                                                 Config::GPS_TASK_PRIORITY, &taskHandle, Config::GPS_TASK_CORE);
+    if (created != pdPASS) {
+        taskHandle = nullptr;
+        uart_driver_delete(GPS_UART);
+        Serial.println("ERROR: Cannot create GPS task");
+        return false;
+    }
+
+    Serial.printf("GPS task started: UART%d %lu baud, %d Hz requested\n", Config::GPS_UART_NUM,
+                  (unsigned long)baudRate, Config::GPS_RATE_HZ);
+    return true;
+}
+
+void GpsReceiver::setBaudRate(uint32_t baud) {
+    uart_wait_tx_done(GPS_UART, pdMS_TO_TICKS(200));
+    uart_set_baudrate(GPS_UART, baud);
+    uart_flush_input(GPS_UART);
+    baudRate = baud;
+}
+
+void GpsReceiver::sendBytes(const uint8_t* data, size_t length) {
+    uart_write_bytes(GPS_UART, reinterpret_cast<const char*>(data), length);
+}
+
+void GpsReceiver::sendUbx(uint8_t msgClass, uint8_t msgId, const uint8_t* payload, uint16_t length) {
+    uint8_t header[6] = {0xB5, 0x62, msgClass, msgId, uint8_t(length & 0xFF), uint8_t(length >> 8)};
+
+    // Fletcher-8 atas class, id, length dan payload
+    uint8_t ckA = 0, ckB = 0;
+    for (int i = 2; i < 6; i++) {
+        ckA += header[i];
+        ckB += ckA;
+    }
+    for (uint16_t i = 0; i < length; i++) {
+        ckA += payload[i];
+        ckB += ckA;
+    }
+    const uint8_t checksum[2] = {ckA, ckB};
+
+    sendBytes(header, sizeof(header));
+    sendBytes(payload, length);
+    sendBytes(checksum, sizeof(checksum));
+}
+
+void GpsReceiver::sendNmea(const char* body) {
+    uint8_t checksum = 0;
+    for (const char* p = body; *p; p++) {
+        checksum ^= uint8_t(*p);
+    }
+    char sentence[96];
+    int length = snprintf(sentence, sizeof(sentence), "$%s*%02X\r\n", body, checksum);
+    if (length > 0 && length < int(sizeof(sentence))) {
+        sendBytes(reinterpret_cast<const uint8_t*>(sentence), length);
+    }
+}
+
+void GpsReceiver::configureReceiver() {
+    // Urutan: ganti baud receiver (masih di baud default), ikuti di sisi ESP32,
+    // lalu rate dan filter sentence di baud baru. Jika receiver sudah di baud
+    // baru (boot sebelumnya), perintah pertama hanya noise dan sisanya tetap masuk.
+#if defined(GPS_RECEIVER_NMEA_ONLY)
+    Serial.println("GPS: receiver configuration disabled (NMEA only)");
+#elif defined(GPS_RECEIVER_PMTK)
+    char body[48];
+    snprintf(body, sizeof(body), "PMTK251,%lu", (unsigned long)Config::GPS_BAUD);
+    sendNmea(body);
+    setBaudRate(Config::GPS_BAUD);
+    delay(100);
+
+    snprintf(body, sizeof(body), "PMTK220,%d", 1000 / Config::GPS_RATE_HZ);
+    sendNmea(body);
+    // Hanya RMC + GGA (yang dipakai TinyGPSPlus) supaya 10 Hz muat di bandwidth
+    sendNmea("PMTK314,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0");
+    Serial.printf("GPS: PMTK config sent (%lu baud, %d Hz)\n", (unsigned long)Config::GPS_BAUD, Config::GPS_RATE_HZ);
+#else
+    // CFG-PRT: UART1, 8N1, baud baru, input UBX+NMEA, output NMEA
+    const uint32_t baud = Config::GPS_BAUD;
+    const uint8_t port[20] = {0x01, 0x00, 0x00, 0x00, 0xD0, 0x08, 0x00, 0x00,
+                              uint8_t(baud), uint8_t(baud >> 8), uint8_t(baud >> 16), uint8_t(baud >> 24),
+                              0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00};
+    sendUbx(0x06, 0x00, port, sizeof(port));
+    setBaudRate(Config::GPS_BAUD);
+    delay(100);
+
+    // CFG-RATE: measurement period ms, 1 navigation per measurement, time ref GPS
+    const uint16_t periodMs = 1000 / Config::GPS_RATE_HZ;
+    const uint8_t rate[6] = {uint8_t(periodMs), uint8_t(periodMs >> 8), 0x01, 0x00, 0x01, 0x00};
+    sendUbx(0x06, 0x08, rate, sizeof(rate));
+
+    // CFG-MSG: matikan GLL, GSA, GSV, VTG; TinyGPSPlus cukup RMC + GGA
+    const uint8_t disabled[] = {0x01, 0x02, 0x03, 0x05};
+    for (uint8_t id : disabled) {
+        const uint8_t msg[3] = {0xF0, id, 0x00};
+        sendUbx(0x06, 0x01, msg, sizeof(msg));
+    }
+    Serial.printf("GPS: UBX config sent (%lu baud, %d Hz)\n", (unsigned long)Config::GPS_BAUD, Config::GPS_RATE_HZ);
+#endif
+}
+
+void GpsReceiver::taskEntry(void* parameter) {
+    static_cast<GpsReceiver*>(parameter)->run();
+}
+
+void GpsReceiver::run() {
+    uint8_t buffer[128];
+    const unsigned long startMillis = millis();
+    bool detected = false;
+    uint32_t epochTime = 0xFFFFFFFF;
+    int64_t epochArrival = 0;
+
+    for (;;) {
+        uart_event_t event;
+        if (xQueueReceive(uartQueue, &event, pdMS_TO_TICKS(500)) != pdTRUE) {
+            event.type = UART_EVENT_MAX;  // hanya cek deteksi di bawah
+        }
+
+        switch (event.type) {
+            case UART_DATA: {
+                size_t pending = event.size;
+                while (pending > 0) {
+                    const int length = uart_read_bytes(GPS_UART, buffer, pending < sizeof(buffer) ? pending : sizeof(buffer), 0);
+                    if (length <= 0) break;
+                    pending -= length;
+
+                    // Byte ke-i tiba kira-kira (sisa byte setelahnya) x waktu per byte sebelum sekarang
+                    const int64_t readMicros = esp_timer_get_time();
+                    const int64_t byteMicros = 10000000 / baudRate;
+                    for (int i = 0; i < length; i++) {
+                        if (!gps.encode(char(buffer[i]))) continue;
+                        if (!gps.location.isUpdated()) continue;
+
+                        const int64_t arrival = readMicros - int64_t(pending + length - 1 - i) * byteMicros;
+                        // RMC dan GGA dari epoch yang sama memakai arrival sentence pertama
+                        if (gps.time.value() != epochTime) {
+                            epochTime = gps.time.value();
+                            epochArrival = arrival;
+                        }
+                        publishFix(epochArrival);
+                    }
+                }
+                passedSentences.store(gps.passedChecksum(), std::memory_order_relaxed);
+                failedSentences.store(gps.failedChecksum(), std::memory_order_relaxed);
+                break;
+            }
+            case UART_FIFO_OVF:
+            case UART_BUFFER_FULL:
+                overflows.fetch_add(1, std::memory_order_relaxed);
+                uart_flush_input(GPS_UART);
+                xQueueReset(uartQueue);
+                break;
+            default:
+                break;
+        }
+
+        // Receiver tidak menerima konfigurasi: kembali ke baud default
+        if (!detected) {
+            if (gps.passedChecksum() > 0) {
+                detected = true;
+            } else if (baudRate != Config::GPS_BAUD_DEFAULT &&
+                       millis() - startMillis > Config::GPS_DETECT_TIMEOUT_MS) {
+                Serial.printf("GPS: no NMEA at %lu baud - falling back to %lu\n", (unsigned long)baudRate,
+                              (unsigned long)Config::GPS_BAUD_DEFAULT);
+                setBaudRate(Config::GPS_BAUD_DEFAULT);
+                detected = true;
+            }
+        }
+    }
+}
+
+void GpsReceiver::publishFix(int64_t arrivalMicros) {
+    GpsFix fix;
+    fix.valid = gps.location.isValid();
+    fix.lat = gps.location.lat();
+    fix.lng = gps.location.lng();
+    fix.speedKmph = gps.speed.kmph();
+    fix.satellites = uint8_t(gps.satellites.value());
+    fix.timeValid = gps.time.isValid() && gps.date.isValid();
+    fix.utcDate = gps.date.value();
+    fix.utcTime = gps.time.value();
+    fix.arrivalMicros = arrivalMicros;
+    fix.sequence = ++fixCount;
+    fixSnapshot.publish(fix);
+}
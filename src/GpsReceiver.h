@@ -0,0 +1,82 @@
+#ifndef GPS_RECEIVER_H
+#define GPS_RECEIVER_H
+
+#include "Config.h"
+#include "SeqlockSnapshot.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <atomic>
+
+// Protokol konfigurasi receiver, dipilih saat build (platformio.ini build_flags):
+//   default                 u-blox (UBX CFG-PRT / CFG-RATE / CFG-MSG)
+//   -DGPS_RECEIVER_PMTK     MediaTek (PMTK251 / PMTK220 / PMTK314)
+//   -DGPS_RECEIVER_NMEA_ONLY tanpa konfigurasi, tetap di GPS_BAUD_DEFAULT
+
+// Fix terbaru yang dipublish task GPS
+struct GpsFix {
+    bool valid;
+    double lat;
+    double lng;
+    float speedKmph;
+    uint8_t satellites;
+    bool timeValid;
+    uint32_t utcDate;               // TinyGPS date.value(): ddmmyy
+    uint32_t utcTime;               // TinyGPS time.value(): hhmmsscc
+    int64_t arrivalMicros;          // esp_timer_get_time() saat byte terakhir sentence diterima
+    uint32_t sequence;              // jumlah fix sejak start
+};
+
+/**
+ * @brief GPS NMEA lewat UART event task (tanpa polling dari loop)
+ *
+ * Driver UART IDF mengirim event saat byte masuk (FIFO threshold atau
+ * RX timeout). Task di core 0 membaca byte saat itu juga dan memberi makan
+ * TinyGPSPlus yang hanya dimiliki task ini, jadi FIFO tidak overflow di
+ * 10 Hz. Setiap sentence yang meng-update posisi dipublish sebagai GpsFix
+ * lewat seqlock, dengan timestamp kedatangan byte terakhir sentence
+ * (waktu baca dikurangi byte yang masih tersisa di buffer).
+ */
+class GpsReceiver {
+private:
+    TinyGPSPlus gps;
+    TaskHandle_t taskHandle;
+    QueueHandle_t uartQueue;
+    SeqlockSnapshot<GpsFix> fixSnapshot;
+    uint32_t baudRate;
+    uint32_t fixCount;
+    // Counter dari task GPS untuk dibaca task lain (gps hanya milik task GPS)
+    std::atomic<uint32_t> overflows;
+    std::atomic<uint32_t> passedSentences;
+    std::atomic<uint32_t> failedSentences;
+
+    static void taskEntry(void* parameter);
+    void run();
+    void configureReceiver();
+    void setBaudRate(uint32_t baud);
+    void sendBytes(const uint8_t* data, size_t length);
+    void sendUbx(uint8_t msgClass, uint8_t msgId, const uint8_t* payload, uint16_t length);
+    void sendNmea(const char* body);
+    void publishFix(int64_t arrivalMicros);
+
+public:
+    GpsReceiver();
+    ~GpsReceiver();
+
+    bool start();
+    bool isRunning() const { return taskHandle != nullptr; }
+
+    // Dipanggil dari loop / task lain
+    bool getLatestFix(GpsFix& fix) const { return fixSnapshot.read(fix); }
+    uint32_t getBaudRate() const { return baudRate; }
+    uint32_t getOverflows() const { return overflows.load(std::memory_order_relaxed); }
+    uint32_t getPassedSentences() const { return passedSentences.load(std::memory_order_relaxed); }
+    uint32_t getFailedSentences() const { return failedSentences.load(std::memory_order_relaxed); }
+
+    static GpsReceiver& getInstance() {
+        static GpsReceiver instance;
+        return instance;
+    }
+};
+
+#endif // GPS_RECEIVER_H
@@ -0,0 +1,494 @@
+#include "HardwareSensorSource.h"
+#include "SensorCalibrationData.h"
+#include <new>
+#include <esp_timer.h>
+#include <driver/adc.h>
+
+static_assert(CAL_CHANNEL_COUNT == ADC_CHANNEL_COUNT, "Urutan channel kalibrasi harus sama dengan AdcChannel");
+
+// Pin per AdcChannel
+static const int ANALOG_PINS[ADC_CHANNEL_COUNT] = {Config::PIN_AFR, Config::PIN_MAP, Config::PIN_TPS,
+                                                   Config::PIN_INCLINE, Config::PIN_STROKE};
+// Input classifier harus ikut frame DMA (bukan analogRead blocking per update)
+static_assert(adc1ChannelForPin(Config::PIN_AFR) >= 0 && adc1ChannelForPin(Config::PIN_MAP) >= 0 &&
+                  adc1ChannelForPin(Config::PIN_TPS) >= 0,
+              "PIN_AFR/PIN_MAP/PIN_TPS harus pin ADC1 (GPIO 32-39)");
+
+HardwareSensorSource::HardwareSensorSource()
+    : gpsReceiver(nullptr), gpsFix(), tempSensor(nullptr), oneWire(nullptr),
+      tempState(TempState::IDLE), tempAddressValid(false), tempRequestTime(0), tempConversionMillis(750),
+      temperature(0.0), adcSampler(nullptr), adcFrame(), adcUnavailable(0), fallbackChannels(0), fallbackValid(0),
+      fallbackSampleMicros(0), fallbackRaw(), started(false) {
+    for (int c = 0; c < CAL_CHANNEL_COUNT; c++) {
+        calCurves[c] = SensorCalibrationData::curves[c];
+        calTables[c] = &SensorCalibrationData::tables[c];
+        loadedTables[c] = nullptr;
+    }
+}
+
+HardwareSensorSource::~HardwareSensorSource() {
+    delete tempSensor;
+    delete oneWire;
+    releaseCalibration();
+}
+// Static instance pointer
+HardwareSensorSource* HardwareSensorSource::instance = nullptr;
+
+// Interrupt handler: hanya mencatat waktu edge
+void IRAM_ATTR HardwareSensorSource::rpmInterruptHandler() {
+    if (instance) {
+        instance->rpmEdges.record(micros());
+    }
+}
+
+// RPM dari rata-rata periode pulse terbaru, dihitung saat dibaca
+float HardwareSensorSource::readRPMSensor() {
+    uint32_t edges[Config::RPM_AVERAGE_PULSES + 1];
+    const int count = rpmEdges.latest(edges, Config::RPM_AVERAGE_PULSES + 1);
+    const uint32_t now = micros();  // setelah salin edge, jadi now >= edges[0]
+
+    // Mesin mati: tidak ada edge dalam timeout
+    if (count < 2 || now - edges[0] > Config::RPM_TIMEOUT_US) {
+        return 0.0;
+    }
+
+    // Rata-rata periode, hanya edge di dalam window (minimal satu periode)
+    int periods = 1;
+    while (periods + 1 < count && edges[0] - edges[periods + 1] <= Config::RPM_AVERAGE_WINDOW_US) {
+        periods++;
+    }
+    float periodMicros = float(edges[0] - edges[periods]) / periods;
+
+    // Saat deselerasi, waktu sejak edge terakhir sudah lebih panjang dari periode
+    const uint32_t sinceLastEdge = now - edges[0];
+    if (sinceLastEdge > periodMicros) {
+        periodMicros = sinceLastEdge;
+    }
+    if (periodMicros <= 0) {
+        return 0.0;
+    }
+
+    float rpm = 60000000.0f / (periodMicros * Config::RPM_PULSES_PER_REV);
+    rpm = constrain(rpm, 0.0f, Config::RPM_MAX);
+    if (rpm < Config::RPM_MIN) rpm = 0;
+    return rpm;
+}
+
+bool HardwareSensorSource::begin(unsigned long nowMillis) {
+    (void)nowMillis;
+    // Hardware hanya diinisialisasi sekali; ganti sumber bolak-balik tidak memasang ulang ISR/task
+    if (started) return true;
+
+    // Initialize analog sensor pins
+    pinMode(Config::PIN_AFR, INPUT);
+    pinMode(Config::PIN_MAP, INPUT);
+    instance = this;
+    
+    pinMode(Config::PIN_RPM, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(Config::PIN_RPM), rpmInterruptHandler, FALLING);
+    pinMode(Config::PIN_TPS, INPUT);
+    pinMode(Config::PIN_INCLINE, INPUT);
+    pinMode(Config::PIN_STROKE, INPUT);
+
+    // ADC kontinu untuk channel analog di ADC1; sisanya di-sample dari poll()
+    adcSampler = &AdcSampler::getInstance();
+    adcSampler->start(ANALOG_PINS);
+    for (int c = 0; c < ADC_CHANNEL_COUNT; c++) {
+        const int analogChannel = digitalPinToAnalogChannel(ANALOG_PINS[c]);
+        if (adcSampler->isSampled(AdcChannel(c)) || analogChannel < 0) continue;
+        fallbackChannels |= uint8_t(1u << c);
+        fallbackFilters.configure(c, adcFilterConfig(AdcChannel(c), ADC_FRAME_RATE_HZ));
+        // Channel fallback di ADC2 dibaca lewat adc2_get_raw supaya blokir WiFi terdeteksi
+        if (analogChannel >= ADC2_CHANNEL_BASE) {
+            adc2_config_channel_atten(adc2_channel_t(analogChannel - ADC2_CHANNEL_BASE), ADC_ATTEN_DB_11);
+        }
+    }
+    loadCalibration();
+
+    
+    // Initialize GPS (task UART sendiri, konfigurasi receiver 10 Hz)
+    gpsReceiver = &GpsReceiver::getInstance();
+    if (!gpsReceiver->start()) {
+        Serial.println("ERROR: GPS receiver not started");
+    }
+    
+    // Initialize temperature sensor
+    oneWire = new OneWire(Config::PIN_TEMP);
+    tempSensor = new DallasTemperature(oneWire);
+    tempSensor->begin();
+    tempAddressValid = tempSensor->getAddress(tempAddress, 0);
+    tempConversionMillis = tempSensor->millisToWaitForConversion(tempSensor->getResolution());
+
+    // Satu konversi blocking saat boot supaya temp valid sebelum klasifikasi pertama,
+    // setelah itu async (requestTemperatures() langsung return)
+    tempSensor->requestTemperatures();
+    temperature = validateTemperature(tempAddressValid ? tempSensor->getTempC(tempAddress)
+                                                       : tempSensor->getTempCByIndex(0));
+    tempSensor->setWaitForConversion(false);
+    tempState = TempState::IDLE;
+    started = true;
+    
+    Serial.println("=== Sensors Initialized ===");
+    Serial.printf("AFR Sensor: Pin %d\n", Config::PIN_AFR);
+    Serial.printf("MAP Sensor: Pin %d\n", Config::PIN_MAP);
+    Serial.printf("TPS Sensor: Pin %d\n", Config::PIN_TPS);
+    Serial.printf("Incline Sensor: Pin %d\n", Config::PIN_INCLINE);
+    Serial.printf("Stroke Sensor: Pin %d\n", Config::PIN_STROKE);
+    Serial.printf("Temperature Sensor: Pin %d (DS18B20)\n", Config::PIN_TEMP);
+    Serial.printf("GPS: RX=%d, TX=%d\n", Config::GPS_RX, Config::GPS_TX);
+    return true;
+}
+
+void HardwareSensorSource::poll(unsigned long nowMillis) {
+    (void)nowMillis;
+    // Setiap loop: langkah state machine DS18B20 (tidak pernah menunggu konversi)
+    // dan sample channel analog non-DMA
+    if (started) {
+        updateTemperatureSensor();
+        sampleFallbackChannels();
+    }
+}
+
+uint32_t HardwareSensorSource::read(unsigned long nowMillis, uint32_t channels, SensorReading& out) {
+    (void)nowMillis;
+    if (!started) return 0;
+
+    // Frame ADC terbaru; jika seqlock sedang ditulis, frame sebelumnya tetap dipakai
+    const uint32_t analog = sensorChannelBit(SensorChannel::AFR) | sensorChannelBit(SensorChannel::TPS) |
+                            sensorChannelBit(SensorChannel::MAP) | sensorChannelBit(SensorChannel::INCLINE) |
+                            sensorChannelBit(SensorChannel::STROKE);
+    if (channels & analog) {
+        AdcFrame frame;
+        if (adcSampler->getLatestFrame(frame)) {
+            adcFrame = frame;
+        }
+    }
+
+    // Channel analog yang gagal dibaca tidak ikut mask: SensorManager mempertahankan nilai lama
+    uint32_t filled = channels;
+    if ((channels & sensorChannelBit(SensorChannel::AFR)) && !readAFRSensor(out.afr)) {
+        filled &= ~sensorChannelBit(SensorChannel::AFR);
+    }
+    if (channels & sensorChannelBit(SensorChannel::RPM)) out.rpm = readRPMSensor();
+    if ((channels & sensorChannelBit(SensorChannel::TPS)) && !readTPSSensor(out.tps)) {
+        filled &= ~sensorChannelBit(SensorChannel::TPS);
+    }
+    if ((channels & sensorChannelBit(SensorChannel::MAP)) && !readMAPSensor(out.map_value)) {
+        filled &= ~sensorChannelBit(SensorChannel::MAP);
+    }
+    if ((channels & sensorChannelBit(SensorChannel::INCLINE)) && !readInclineSensor(out.incline)) {
+        filled &= ~sensorChannelBit(SensorChannel::INCLINE);
+    }
+    if ((channels & sensorChannelBit(SensorChannel::STROKE)) && !readStrokeSensor(out.stroke)) {
+        filled &= ~sensorChannelBit(SensorChannel::STROKE);
+    }
+
+    if (channels & sensorChannelBit(SensorChannel::TEMP)) {
+        // Konversi DS18B20 hanya dimulai saat channel TEMP jatuh tempo; nilai = konversi terakhir
+        if (tempState == TempState::IDLE) {
+            tempSensor->requestTemperatures();
+            tempRequestTime = millis();
+            tempState = TempState::CONVERTING;
+        }
+        out.temp = temperature;
+    }
+
+    if (channels & sensorChannelBit(SensorChannel::GPS)) {
+        // Byte NMEA diproses di task GPS; di sini hanya ambil fix terbaru
+        GpsFix fix;
+        if (gpsReceiver->getLatestFix(fix)) {
+            gpsFix = fix;
+        }
+        out.gpsValid = isFixFresh();
+        out.lat = gpsFix.lat;
+        out.lng = gpsFix.lng;
+        out.speed = out.gpsValid ? gpsFix.speedKmph : 0.0;
+        out.satellites = gpsFix.satellites;
+    }
+    return filled;
+}
+
+bool HardwareSensorSource::isFixFresh() const {
+    // Fix yang tidak diperbarui lagi (antena tertutup, receiver hilang) tidak dipakai
+    return gpsFix.valid && gpsFix.sequence > 0 &&
+           esp_timer_get_time() - gpsFix.arrivalMicros < int64_t(Config::GPS_FIX_STALE_MS) * 1000;
+}
+
+// Satu pembacaan pin non-DMA. False jika pin tidak bisa dibaca: pin tidak valid,
+// atau ADC2 saat WiFi aktif (analogRead akan log error dan memberi 0 setiap panggilan).
+// Pin yang di-DMA tidak boleh di-analogRead (ADC1 dipegang digital controller).
+bool HardwareSensorSource::readAnalogPin(AdcChannel channel, int& raw) {
+    const uint8_t bit = uint8_t(1u << int(channel));
+    const int pin = ANALOG_PINS[int(channel)];
+    const int analogChannel = digitalPinToAnalogChannel(pin);
+    if (analogChannel >= ADC2_CHANNEL_BASE) {
+        if (adc2_get_raw(adc2_channel_t(analogChannel - ADC2_CHANNEL_BASE), ADC_WIDTH_BIT_12, &raw) != ESP_OK) {
+            // Sekali per gangguan, bukan per sample
+            if (!(adcUnavailable & bit)) {
+                Serial.printf("WARNING: %s pin %d is on ADC2 and in use by WiFi - channel not updated\n",
+                              CAL_CHANNEL_NAMES[int(channel)], pin);
+            }
+            adcUnavailable |= bit;
+            return false;
+        }
+        adcUnavailable &= ~bit;
+        return true;
+    }
+    if (analogChannel < 0) {
+        return false;
+    }
+    raw = analogRead(pin);
+    return true;
+}
+
+// Channel yang tidak di-DMA di-sample di rate frame ADC dan lewat filter bank
+// dengan konfigurasi yang sama (Config::ADC_FILTER_*), bukan di rate scheduler.
+// Loop yang terlambat hanya mengambil satu sample.
+void HardwareSensorSource::sampleFallbackChannels() {
+    const int64_t now = esp_timer_get_time();
+    if (fallbackChannels == 0 || now - fallbackSampleMicros < int64_t(1000000 / ADC_FRAME_RATE_HZ)) {
+        return;
+    }
+    fallbackSampleMicros = now;
+    for (int c = 0; c < ADC_CHANNEL_COUNT; c++) {
+        int raw;
+        if (!(fallbackChannels & (1u << c)) || !readAnalogPin(AdcChannel(c), raw)) continue;
+        fallbackRaw[c] = fallbackFilters.process(c, int32_t(raw) << FILTER_INPUT_SHIFT) *
+                         (1.0f / (1 << FILTER_INPUT_SHIFT));
+        fallbackValid |= uint8_t(1u << c);
+    }
+}
+
+// Raw ADC 0-4095 setelah filter bank: frame DMA terbaru, atau sample fallback
+// terakhir. False jika belum ada sample (awal boot) atau pin sedang tidak terbaca,
+// supaya raw 0 tidak dipublish sebagai nilai kalibrasi.
+bool HardwareSensorSource::readAnalogRaw(AdcChannel channel, float& raw) {
+    const int c = int(channel);
+    if (adcSampler && adcSampler->isSampled(channel)) {
+        raw = adcFrame.filtered[c];
+        return adcFrame.samples[c] > 0;
+    }
+    raw = fallbackRaw[c];
+    return (fallbackValid & (1u << c)) && !(adcUnavailable & (1u << c));
+}
+
+bool HardwareSensorSource::readCalibrated(AdcChannel channel, float& value) {
+    float raw;
+    if (!readAnalogRaw(channel, raw)) return false;
+    value = calTables[int(channel)]->lookup(raw);
+    return true;
+}
+
+bool HardwareSensorSource::readAFRSensor(float& afr) {
+    return readCalibrated(AdcChannel::AFR, afr);
+}
+
+bool HardwareSensorSource::readMAPSensor(float& map) {
+    return readCalibrated(AdcChannel::MAP, map);
+}
+
+// float HardwareSensorSource::readTPSSensor() { // ini yang belum di pulldown
+//     // Baca nilai ADC mentah
+//     int rawValue = analogRead(Config::PIN_TPS);
+    
+//     // Konversi ke persentase (0-100% berdasarkan ADC 12-bit)
+//     float percentage = (rawValue / 4095.0) * 100.0;
+    
+//     // Konstrain nilai dalam range yang valid
+//     percentage = constrain(percentage, 0, 100);
+    
+//     // Mapping dari range aktual (16-100) ke range yang diinginkan (0-100)
+//     if (percentage >= 16.0) {
+//         // Gunakan map() dengan floating point
+//         percentage = ((percentage - 16.0) / (100.0 - 16.0)) * 100.0;
+//     } else {
+//         // Jika pembacaan di bawah 16%, anggap sebagai 0%
+//         percentage = 0.0;
+//     }
+    
+//     // Konstrain hasil akhir
+//     percentage = constrain(percentage, 0, 100);
+    
+//     return percentage;
+// }
+bool HardwareSensorSource::readTPSSensor(float& percentage) {
+    // Frame ADC sudah di-smooth filter bank (median + IIR) di rate frame,
+    // lalu tabel kalibrasi TPS (default: tertutup <= 1.2 V, idle 0.6 V .. WOT 4.5 V)
+    if (!readCalibrated(AdcChannel::TPS, percentage)) {
+        return false;
+    }
+    
+    // Dead zone untuk mengurangi jitter di idle
+    if (percentage < 2.0) {
+        percentage = 0.0;
+    }
+    
+    return true;
+}
+
+
+bool HardwareSensorSource::readInclineSensor(float& incline) {
+    return readCalibrated(AdcChannel::INCLINE, incline);
+}
+
+bool HardwareSensorSource::readStrokeSensor(float& stroke) {
+    return readCalibrated(AdcChannel::STROKE, stroke);
+}
+
+void HardwareSensorSource::updateTemperatureSensor() {
+    unsigned long now = millis();
+
+    // Konversi dimulai oleh read() saat channel TEMP jatuh tempo; di antara itu bus diam
+    if (tempState == TempState::IDLE) {
+        return;
+    }
+
+    // Sebelum waktu konversi minimum lewat, bus tidak disentuh sama sekali
+    unsigned long elapsed = now - tempRequestTime;
+    if (elapsed < tempConversionMillis) {
+        return;
+    }
+
+    if (tempSensor->isConversionComplete()) {
+        float temp = tempAddressValid ? tempSensor->getTempC(tempAddress) : tempSensor->getTempCByIndex(0);
+        temperature = validateTemperature(temp);
+    } else if (elapsed < tempConversionMillis + Config::TEMP_CONVERSION_TIMEOUT_MS) {
+        return;  // poll lagi di loop berikutnya
+    } else {
+        Serial.println("Warning: Temperature conversion timeout");
+        temperature = validateTemperature(DEVICE_DISCONNECTED_C);
+    }
+    tempState = TempState::IDLE;
+}
+
+float HardwareSensorSource::validateTemperature(float temp) {
+    if (isnan(temp) || temp == DEVICE_DISCONNECTED_C) {
+        Serial.println("Warning: Temperature sensor error, using default value");
+        temp = 85.0;
+    }
+    
+    if (temp < -40.0) temp = -40.0;
+    if (temp > 150.0) temp = 150.0;
+    return temp;
+}
+
+void HardwareSensorSource::releaseCalibration() {
+    for (int c = 0; c < CAL_CHANNEL_COUNT; c++) {
+        calCurves[c] = SensorCalibrationData::curves[c];
+        calTables[c] = &SensorCalibrationData::tables[c];
+        delete loadedTables[c];
+        loadedTables[c] = nullptr;
+    }
+}
+
+bool HardwareSensorSource::loadCalibration(const char* path) {
+    if (!SPIFFS.begin(true) || !SPIFFS.exists(path)) {
+        Serial.printf("No calibration file %s - using default sensor curves\n", path);
+        return false;
+    }
+    File file = SPIFFS.open(path, "r");
+    if (!file) {
+        Serial.printf("WARNING: Cannot open %s - using default sensor curves\n", path);
+        return false;
+    }
+
+    // Kurva baru dikumpulkan dulu; kalibrasi aktif hanya diganti jika seluruh file valid
+    static CalCurve curves[CAL_CHANNEL_COUNT];
+    for (int c = 0; c < CAL_CHANNEL_COUNT; c++) {
+        curves[c].count = 0;
+    }
+    char line[96];
+    int lineNumber = 0;
+    bool valid = true;
+    while (valid && file.available()) {
+        size_t length = file.readBytesUntil('\n', line, sizeof(line) - 1);
+        line[length] = '\0';
+        lineNumber++;
+
+        int channel;
+        CalPoint point;
+        const int parsed = parseCalibrationLine(line, channel, point);
+        if (parsed < 0 || (parsed > 0 && curves[channel].count >= CAL_MAX_POINTS)) {
+            Serial.printf("WARNING: %s line %d invalid: '%s'\n", path, lineNumber, line);
+            valid = false;
+        } else if (parsed > 0) {
+            curves[channel].points[curves[channel].count++] = point;
+        }
+    }
+    file.close();
+
+    for (int c = 0; valid && c < CAL_CHANNEL_COUNT; c++) {
+        if (curves[c].count > 0 && !calCurveValid(curves[c])) {
+            Serial.printf("WARNING: %s curve for %s invalid (2-%d points, raw 0-4095 ascending)\n", path,
+                          CAL_CHANNEL_NAMES[c], CAL_MAX_POINTS);
+            valid = false;
+        }
+    }
+    if (!valid) {
+        Serial.println("Calibration unchanged");
+        return false;
+    }
+
+    // Tabel 8 KB per channel yang dikalibrasi, dibangun sekali di sini
+    CalTable *tables[CAL_CHANNEL_COUNT] = {};
+    for (int c = 0; c < CAL_CHANNEL_COUNT; c++) {
+        if (curves[c].count == 0) continue;
+        tables[c] = new (std::nothrow) CalTable;
+        if (!tables[c]) {
+            Serial.println("ERROR: Not enough memory for calibration tables");
+            for (int t = 0; t < CAL_CHANNEL_COUNT; t++) delete tables[t];
+            return false;
+        }
+        calFillTable(curves[c], *tables[c]);
+    }
+
+    releaseCalibration();
+    int calibrated = 0;
+    for (int c = 0; c < CAL_CHANNEL_COUNT; c++) {
+        if (!tables[c]) continue;
+        calCurves[c] = curves[c];
+        loadedTables[c] = tables[c];
+        calTables[c] = tables[c];
+        calibrated++;
+    }
+    Serial.printf("Calibration loaded from %s: %d channel(s)\n", path, calibrated);
+    return true;
+}
+
+bool HardwareSensorSource::saveCalibration(const char* path) const {
+    // Tulis ulang kurva yang dimuat dari file, mis. setelah SPIFFS di-format saat mulai recording
+    File file = SPIFFS.open(path, "w");
+    if (!file) return false;
+    file.println("# channel raw value");
+    for (int c = 0; c < CAL_CHANNEL_COUNT; c++) {
+        if (!loadedTables[c]) continue;
+        for (int i = 0; i < calCurves[c].count; i++) {
+            file.printf("%s %.1f %.3f\n", CAL_CHANNEL_NAMES[c], calCurves[c].points[i].raw,
+                        calCurves[c].points[i].value);
+        }
+    }
+    file.close();
+    return true;
+}
+
+void HardwareSensorSource::useDefaultCalibration() {
+    releaseCalibration();
+    Serial.println("Calibration: default sensor curves");
+}
+
+bool HardwareSensorSource::hasCustomCalibration() const {
+    for (int c = 0; c < CAL_CHANNEL_COUNT; c++) {
+        if (loadedTables[c]) return true;
+    }
+    return false;
+}
+
+void HardwareSensorSource::printCalibration() const {
+    Serial.println("=== SENSOR CALIBRATION ===");
+    for (int c = 0; c < CAL_CHANNEL_COUNT; c++) {
+        const CalCurve &curve = calCurves[c];
+        Serial.printf("%-8s %-7s %d points, raw 0 -> %.2f, 2048 -> %.2f, 4095 -> %.2f\n", CAL_CHANNEL_NAMES[c],
+                      loadedTables[c] ? "file" : "default", curve.count, calTables[c]->lookup(0),
+                      calTables[c]->lookup(2048), calTables[c]->lookup(4095));
+    }
+}
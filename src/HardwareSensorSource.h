@@ -0,0 +1,98 @@
+#ifndef HARDWARE_SENSOR_SOURCE_H
+#define HARDWARE_SENSOR_SOURCE_H
+
+#include "DataStructures.h"
+#include "SensorSource.h"
+#include "PulseTimestampRing.h"
+#include "AdcSampler.h"
+#include "GpsReceiver.h"
+#include "SensorCalibration.h"
+
+/**
+ * @brief Sumber sensor fisik: pin analog (ADC DMA), RPM, DS18B20 dan GPS
+ *
+ * Semua akses hardware yang sebelumnya ada di SensorManager. read() hanya
+ * membaca channel yang diminta (frame ADC, RPM, fix GPS, atau memulai
+ * konversi DS18B20), poll() menyelesaikan konversi DS18B20 yang berjalan.
+ */
+class HardwareSensorSource : public ISensorSource
+{
+private:
+    // GPS: fix terbaru dari GpsReceiver (UART event task)
+    GpsReceiver *gpsReceiver;
+    GpsFix gpsFix;
+    DallasTemperature *tempSensor;
+    OneWire *oneWire;
+    // RPM sensor: timestamp edge dari ISR, RPM dari rata-rata periode
+    static HardwareSensorSource* instance;
+    PulseTimestampRing<Config::RPM_EDGE_RING_SIZE> rpmEdges;
+
+    // DS18B20: mulai konversi, poll sampai selesai, baca lalu cache di temperature
+    enum class TempState { IDLE, CONVERTING };
+    TempState tempState;
+    DeviceAddress tempAddress;
+    bool tempAddressValid;
+    unsigned long tempRequestTime;
+    unsigned long tempConversionMillis;
+    float temperature;
+
+    // Channel analog dari frame ADC DMA terbaru
+    AdcSampler *adcSampler;
+    AdcFrame adcFrame;
+    uint8_t adcUnavailable;  // bit AdcChannel: read ADC2 terakhir gagal (WiFi)
+    // Channel non-DMA: analogRead/adc2 di poll() pada rate frame, filter bank sendiri
+    uint8_t fallbackChannels;
+    uint8_t fallbackValid;
+    int64_t fallbackSampleMicros;
+    float fallbackRaw[ADC_CHANNEL_COUNT];
+    FilterBank<ADC_CHANNEL_COUNT, Config::ADC_FILTER_MAX_MEDIAN> fallbackFilters;
+    bool started;
+
+    // digitalPinToAnalogChannel: 0-9 = ADC1, 10-19 = ADC2 (arduino-esp32)
+    static constexpr int ADC2_CHANNEL_BASE = 10;
+
+    // Kalibrasi per channel: tabel default di flash, atau tabel heap dari file
+    CalCurve calCurves[CAL_CHANNEL_COUNT];
+    const CalTable *calTables[CAL_CHANNEL_COUNT];
+    CalTable *loadedTables[CAL_CHANNEL_COUNT];
+
+    static void IRAM_ATTR rpmInterruptHandler();
+    float readRPMSensor();
+    bool readAnalogPin(AdcChannel channel, int& raw);
+    void sampleFallbackChannels();
+    bool readAnalogRaw(AdcChannel channel, float& raw);
+    bool readCalibrated(AdcChannel channel, float& value);
+    void releaseCalibration();
+    bool readAFRSensor(float& afr);
+    bool readMAPSensor(float& map);
+    bool readTPSSensor(float& percentage);
+    bool readInclineSensor(float& incline);
+    bool readStrokeSensor(float& stroke);
+    void updateTemperatureSensor();
+    float validateTemperature(float temp);
+    bool isFixFresh() const;
+
+public:
+    HardwareSensorSource();
+    ~HardwareSensorSource();
+
+    const char* name() const override { return "HW"; }
+    bool begin(unsigned long nowMillis) override;
+    void poll(unsigned long nowMillis) override;
+    uint32_t read(unsigned long nowMillis, uint32_t channels, SensorReading& out) override;
+
+    // Kalibrasi (serial SENSOR_CAL): channel yang tidak ada di file tetap default
+    bool loadCalibration(const char* path = Config::SENSOR_CALIBRATION_FILE);
+    bool saveCalibration(const char* path = Config::SENSOR_CALIBRATION_FILE) const;
+    void useDefaultCalibration();
+    bool hasCustomCalibration() const;
+    void printCalibration() const;
+
+    static HardwareSensorSource &getInstance()
+    {
+        static HardwareSensorSource instance;
+        return instance;
+    }
+};
+
+#endif // HARDWARE_SENSOR_SOURCE_H
@@ -4,23 +4,60 @@
 #include <Arduino.h>
 #include "Config.h"
 #include "DataStructures.h"
+#include "KnnModel.h"
+#include "KnnTopK.h"
+#include "KnnQuantized.h"
+#include "KnnKdTree.h"
+#include "KnnDecisionGridData.h"
+#include "KnnBatch.h"
+#include "KnnOnlineSet.h"
+#include "KnnProfiler.h"
+#include "KnnClassificationCache.h"
+#include "KnnModelFile.h"
 #include <Adafruit_ST7735.h>
 
-// Training data structure for 4-class system
+// Engine KNN untuk model yang di-compile: ukuran dari KnnModel, K dan jumlah
+// kelas dari Config. Ganti dataset di KnnModel.h untuk model dengan feature
+// lain (mis. 7 feature + incline/stroke) tanpa mengubah kode classifier.
+typedef KnnEngine<KnnModel::NUM_SAMPLES, KnnModel::NUM_FEATURES, Config::K_VALUE, Config::NUM_CLASSES>
+    KnnClassifierEngine;
 
+static_assert(Config::TRAIN_DATA_SIZE == KnnTrainingData::NUM_SAMPLES,
+              "Config::TRAIN_DATA_SIZE tidak sama dengan KnnTrainingData::NUM_SAMPLES");
+static_assert(Config::NUM_CLASSES == KnnModel::NUM_CLASSES,
+              "Config::NUM_CLASSES tidak sama dengan jumlah kelas model");
 
 class KNNClassifier {
+public:
+    static constexpr int NUM_FEATURES = KnnClassifierEngine::NUM_FEATURES;
+
 private:
-    // Static arrays untuk training data (akan diisi dari Python)
-    static float featureMeans[5];
-    static float featureStds[5];
-    static TrainingData trainingSet[200];  // Fixed size 200 for 4-class training
+    // Training data ada di KnnModel (constexpr, sudah ter-normalisasi)
+    static constexpr KnnClassifierEngine builtinEngine = KnnModel::makeEngine<Config::K_VALUE, Config::NUM_CLASSES>();
+
+    // Engine aktif: builtinEngine atau view atas model file di modelImage
+    KnnClassifierEngine engine;
+    uint8_t* modelImage;     // isi file model utuh (heap), nullptr = model compiled
+    size_t modelImageSize;
+    KnnModelFileView<NUM_FEATURES> fileModel;
+
+    // Sample berlabel dari lintasan, di-scan setelah training set
+    KnnOnlineSet<NUM_FEATURES, Config::ONLINE_SAMPLE_CAPACITY, Config::NUM_CLASSES> onlineSet;
+    KnnEvictionPolicy evictionPolicy;
+
+    KnnBackend backend;
+    KnnClassifierEngine::KdTree kdTree;  // index spasial untuk backend KD_TREE
+    KnnClassificationCache<Config::CLASSIFICATION_CACHE_SLOTS, NUM_FEATURES> cache;
+    bool cacheEnabled;
+    uint32_t missMicros;  // total waktu klasifikasi saat cache miss
     
     // Private methods
-    void normalizeFeatures(float* features);
-    float calculateEuclideanDistance(const float* testFeatures, const float* trainFeatures);
-    void findKNearest(Distance distances[], int size);
-    int runKNNClassification(float afr, float rpm, float temp, float tps, float mapValue);
+    int classifyUncached(const SensorData& data, const float (&features)[NUM_FEATURES]);
+    int runKNNClassification(const SensorData& data, const float (&features)[NUM_FEATURES]);
+    int runGridLookup(const SensorData& data);
+    static float getNoiseFloor(KnnChannel channel);
+    void activateEngine(const KnnClassifierEngine& newEngine);
+    void releaseModelImage();
 
 public:
     KNNClassifier();
@@ -31,11 +68,47 @@ public:
     // Main classification methods
     int classify(const SensorData& data);  // Uses hybrid approach
     int classifyEngineCondition(float afr, float rpm, float temp, float tps, float mapValue);
+    // Banyak baris sekaligus (mis. re-label rekaman), hasil sama dengan classify()
+    void classifyBatch(const SensorData* rows, size_t count, int* out);
+    
+    // Latency per panggilan untuk satu backend (tanpa cache), lihat KnnProfiler.h.
+    // samples minimal runs elemen. Backend aktif dikembalikan setelahnya.
+    bool benchmark(KnnBackend benchBackend, uint32_t runs, float* samples, KnnBenchStats& stats);
+    
+    // Backend selection
+    bool setBackend(KnnBackend newBackend);
+    KnnBackend getBackend() const { return backend; }
+    bool setBackendByName(const String& name);
+    static const char* getBackendName(KnnBackend backend);
+    
+    // Model source: file SPIFFS (tools/knn_model_pack.cpp) atau compiled
+    bool loadModelFile(const char* path = Config::KNN_MODEL_FILE);
+    void useBuiltinModel();
+    bool saveModelFile(const char* path = Config::KNN_MODEL_FILE);
+    bool isFileModel() const { return modelImage != nullptr; }
+    uint32_t getTrainingSize() const { return engine.size(); }
+    void printModelInfo();
+    
+    // Online learning (sample tambahan, kapasitas tetap)
+    int learnSample(const SensorData& data, int label);
+    void clearOnlineSamples();
+    bool saveOnlineSamples(const char* path = Config::KNN_ONLINE_FILE);
+    bool loadOnlineSamples(const char* path = Config::KNN_ONLINE_FILE);
+    void setEvictionPolicy(KnnEvictionPolicy policy) { evictionPolicy = policy; }
+    KnnEvictionPolicy getEvictionPolicy() const { return evictionPolicy; }
+    uint32_t getOnlineSampleCount() const { return onlineSet.size(); }
+    void printOnlineStats();
+    
+    // Classification cache
+    void setCacheEnabled(bool enabled);
+    bool isCacheEnabled() const { return cacheEnabled; }
+    void resetCacheStats();
+    void printCacheStats();
     
     // Utility methods
     String getClassificationText(int classification);
     uint16_t getClassificationColor(int classification);
-    void logClassificationResult(const SensorData& data, int classification, unsigned long executionTime);
+    void logClassificationResult(const SensorData& data, int classification, unsigned long executionMicros);
     
     // Debug methods
     void printTrainingDataSample();
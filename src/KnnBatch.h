@@ -0,0 +1,121 @@
+#ifndef KNN_BATCH_H
+#define KNN_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "KnnEngine.h"
+#include "KnnDecisionGridData.h"
+
+// KnnBatch.h
+// Jalur klasifikasi hybrid (rules + KNN) untuk banyak baris sekaligus,
+// mis. re-label sesi rekaman setelah model diganti. Baris diproses per blok
+// KNN_BATCH_BLOCK: rules dulu, lalu baris yang tersisa di-extract dan
+// dinormalisasi bersama (mean/std per feature dibaca sekali per blok), dan
+// backend dipilih sekali per blok, bukan per baris. Hasilnya identik dengan
+// KNNClassifier::classify tanpa cache. Tidak bergantung pada Arduino supaya
+// tools/knn_relabel.cpp memakai kode yang sama.
+
+static constexpr size_t KNN_BATCH_BLOCK = 32;
+
+// Rules hybrid sebelum KNN; -1 berarti keputusan diserahkan ke KNN
+template <typename Sensor>
+inline int knnHybridRule(const Sensor& data) {
+    // Rule 1: TPS = 0 context-aware classification (toleransi noise sensor)
+    if (data.tps < 1.0f) {
+        if (data.temp < 65.0f) {
+            return 1;  // Normal Startup (cold engine)
+        } else if (data.temp >= 75.0f) {
+            return 2;  // Maintenance Required (warm engine, throttle stuck)
+        }
+        // Temp borderline (65-75°C) pakai KNN
+    }
+
+    // Rule 2: Critical AFR detection
+    if (data.afr >= 11.0f && data.afr <= 12.0f) {
+        return 3;  // Critical Condition (very rich mixture)
+    }
+    return -1;
+}
+
+// Jalur satu sample dengan cache (KNNClassifier::classify): rules dievaluasi
+// sebelum cache, jadi hanya tahap KNN yang di-memoize. Bucket noise floor
+// boleh memotong batas rule (mis. AFR 12.0 di bucket [12.0, 12.1)) tanpa
+// hasil rule terbawa ke input di luar rule. knn() dipanggil hanya saat miss.
+template <typename Cache, typename Sensor, typename Features, typename KnnFn>
+inline int knnClassifyCached(Cache& cache, const Sensor& data, const Features& features, KnnFn&& knn) {
+    const int rule = knnHybridRule(data);
+    if (rule >= 0) return rule;
+
+    const auto key = cache.makeKey(features);
+    int result;
+    if (cache.lookup(key, result)) return result;
+    result = knn();
+    cache.store(key, result);
+    return result;
+}
+
+// Grid memakai nilai raw (AFR, RPM, temp, TPS, MAP), tidak perlu normalisasi
+template <typename Sensor>
+inline int knnGridClassify(const Sensor& data) {
+    const float raw[KnnDecisionGridData::NUM_FEATURES] = {data.afr, data.rpm, data.temp, data.tps, data.map_value};
+    return knnGridLookup(KnnDecisionGridData::layout, KnnDecisionGridData::codes, raw);
+}
+
+// kdTree boleh nullptr jika backend bukan KD_TREE
+template <typename Engine, typename Sensor>
+void knnClassifyBatch(const Engine& engine, KnnBackend backend, const typename Engine::KdTree* kdTree,
+                      const Sensor* rows, size_t count, int* out) {
+    constexpr int D = Engine::NUM_FEATURES;
+    if (backend == KnnBackend::KD_TREE && (!kdTree || !kdTree->isBuilt())) {
+        backend = KnnBackend::FLOAT_SCAN;
+    }
+
+    float block[KNN_BATCH_BLOCK][D];
+    size_t pending[KNN_BATCH_BLOCK];
+
+    for (size_t base = 0; base < count; base += KNN_BATCH_BLOCK) {
+        const size_t blockSize = count - base < KNN_BATCH_BLOCK ? count - base : KNN_BATCH_BLOCK;
+
+        // 1. Rules; baris yang belum diputuskan dikumpulkan
+        size_t numPending = 0;
+        for (size_t i = 0; i < blockSize; i++) {
+            const int rule = knnHybridRule(rows[base + i]);
+            if (rule >= 0) {
+                out[base + i] = rule;
+            } else {
+                pending[numPending++] = base + i;
+            }
+        }
+        if (numPending == 0) continue;
+
+        if (backend == KnnBackend::DECISION_GRID) {
+            for (size_t j = 0; j < numPending; j++) out[pending[j]] = knnGridClassify(rows[pending[j]]);
+            continue;
+        }
+
+        // 2. Extract lalu z-score satu blok, feature demi feature
+        for (size_t j = 0; j < numPending; j++) engine.extract(rows[pending[j]], block[j]);
+        KNN_UNROLL
+        for (int f = 0; f < D; f++) {
+            const float mean = engine.mean(f);
+            const float stddev = engine.stddev(f);
+            for (size_t j = 0; j < numPending; j++) block[j][f] = (block[j][f] - mean) / stddev;
+        }
+
+        // 3. Satu dispatch backend untuk seluruh blok
+        switch (backend) {
+            case KnnBackend::QUANTIZED:
+                for (size_t j = 0; j < numPending; j++) out[pending[j]] = engine.classifyQuantized(block[j]);
+                break;
+            case KnnBackend::KD_TREE:
+                for (size_t j = 0; j < numPending; j++) out[pending[j]] = engine.classifyKdTree(*kdTree, block[j]);
+                break;
+            case KnnBackend::FLOAT_SCAN:
+            default:
+                for (size_t j = 0; j < numPending; j++) out[pending[j]] = engine.classifyScan(block[j]);
+                break;
+        }
+    }
+}
+
+#endif // KNN_BATCH_H
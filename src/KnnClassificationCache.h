@@ -0,0 +1,107 @@
+#ifndef KNN_CLASSIFICATION_CACHE_H
+#define KNN_CLASSIFICATION_CACHE_H
+
+#include <stdint.h>
+
+// KnnClassificationCache.h
+// Cache hasil tahap KNN di KNNClassifier::classify (setelah rules hybrid,
+// lihat knnClassifyCached di KnnBatch.h). Key = vector
+// feature raw yang di-quantize ke noise floor tiap channel: perubahan di
+// bawah noise floor dianggap noise, jadi hasil sebelumnya dipakai ulang
+// tanpa scan. Direct-mapped, tanpa heap.
+
+template <int SLOTS, int CHANNELS>
+class KnnClassificationCache {
+public:
+    static_assert((SLOTS & (SLOTS - 1)) == 0, "SLOTS must be a power of two");
+
+    struct Key {
+        int32_t codes[CHANNELS];
+    };
+
+    KnnClassificationCache() : hits(0), misses(0) {
+        for (int c = 0; c < CHANNELS; c++) inverseStep[c] = 1.0f;
+        clear();
+    }
+
+    // Noise floor per channel dalam satuan sensor, urutan = urutan feature
+    void setNoiseFloor(const float (&steps)[CHANNELS]) {
+        for (int c = 0; c < CHANNELS; c++) {
+            inverseStep[c] = steps[c] > 0 ? 1.0f / steps[c] : 1.0f;
+        }
+        clear();
+    }
+
+    Key makeKey(const float (&values)[CHANNELS]) const {
+        Key key;
+        for (int c = 0; c < CHANNELS; c++) {
+            float scaled = values[c] * inverseStep[c];
+            // floor() tanpa libm untuk nilai negatif (mis. temp di bawah 0)
+            int32_t code = int32_t(scaled);
+            if (float(code) > scaled) code--;
+            key.codes[c] = code;
+        }
+        return key;
+    }
+
+    bool lookup(const Key& key, int& result) {
+        const Entry& entry = entries[slotFor(key)];
+        if (entry.valid && sameKey(entry.key, key)) {
+            result = entry.result;
+            hits++;
+            return true;
+        }
+        misses++;
+        return false;
+    }
+
+    void store(const Key& key, int result) {
+        Entry& entry = entries[slotFor(key)];
+        entry.key = key;
+        entry.result = int8_t(result);
+        entry.valid = true;
+    }
+
+    // Hapus isi cache (mis. setelah backend diganti), counter tetap
+    void clear() {
+        for (int i = 0; i < SLOTS; i++) entries[i].valid = false;
+    }
+
+    void resetStats() {
+        hits = 0;
+        misses = 0;
+    }
+
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+
+private:
+    struct Entry {
+        Key key;
+        int8_t result;
+        bool valid;
+    };
+
+    Entry entries[SLOTS];
+    float inverseStep[CHANNELS];
+    uint32_t hits;
+    uint32_t misses;
+
+    static bool sameKey(const Key& a, const Key& b) {
+        for (int c = 0; c < CHANNELS; c++) {
+            if (a.codes[c] != b.codes[c]) return false;
+        }
+        return true;
+    }
+
+    static uint32_t slotFor(const Key& key) {
+        // Fibonacci hashing: bit atas hasil perkalian tersebar merata
+        uint32_t hash = 0;
+        for (int c = 0; c < CHANNELS; c++) {
+            hash = (hash ^ uint32_t(key.codes[c])) * 0x9E3779B1u;
+        }
+        return (hash >> 16) & (SLOTS - 1);
+    }
+};
+
+#endif // KNN_CLASSIFICATION_CACHE_H
@@ -0,0 +1,32 @@
+#ifndef KNN_CONDENSED_DATA_H
+#define KNN_CONDENSED_DATA_H
+
+// KnnCondensedData.h
+// GENERATED oleh tools/knn_condense.cpp - jangan diedit manual.
+// Prototype subset dari KnnTrainingData (13 dari 200 baris) yang
+// mengklasifikasi semua baris training sama dengan model penuh.
+// Normalisasi tetap memakai KnnTrainingData::featureMeans/featureStds.
+
+#include "KnnTrainingData.h"
+
+struct KnnCondensedData {
+    static constexpr int NUM_SAMPLES = 13;
+
+    static constexpr KnnRawSample samples[NUM_SAMPLES] = {
+      {14.2, 3186, 100.0, 45.3, 111.3, 0},  // Sample 1, Class: Normal
+      {14.2, 2755, 87.4, 50.1, 123.3, 0},  // Sample 2, Class: Normal
+      {13.8, 1389, 55.3, 0.0, 95.0, 1},  // Sample 51, Class: Startup
+      {13.8, 965, 57.4, 0.0, 72.7, 1},  // Sample 53, Class: Startup
+      {14.2, 1269, 65.0, 0.0, 59.3, 1},  // Sample 65, Class: Startup
+      {15.0, 1647, 79.5, 0.0, 76.2, 2},  // Sample 101, Class: Maintenance
+      {14.6, 1200, 84.4, 0.0, 84.0, 2},  // Sample 103, Class: Maintenance
+      {14.1, 1829, 75.4, 0.0, 60.0, 2},  // Sample 122, Class: Maintenance
+      {13.0, 1688, 77.6, 0.0, 60.5, 2},  // Sample 133, Class: Maintenance
+      {14.5, 1676, 83.2, 0.0, 66.2, 2},  // Sample 139, Class: Maintenance
+      {13.5, 1643, 80.6, 0.0, 95.8, 2},  // Sample 150, Class: Maintenance
+      {11.5, 3267, 116.3, 74.2, 130.0, 3},  // Sample 151, Class: Critical
+      {11.6, 4081, 108.2, 53.3, 173.9, 3}  // Sample 152, Class: Critical
+    };
+};
+
+#endif // KNN_CONDENSED_DATA_H
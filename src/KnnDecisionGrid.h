@@ -0,0 +1,83 @@
+#ifndef KNN_DECISION_GRID_H
+#define KNN_DECISION_GRID_H
+
+#include <stdint.h>
+
+// KnnDecisionGrid.h
+// Keputusan KNN yang sudah dihitung offline di grid 5-D atas range sensor
+// fisik (nilai raw, tanpa normalisasi). Setiap cell menyimpan class code
+// 2-bit (4 kelas) bit-packed, 4 cell per byte, sehingga klasifikasi menjadi
+// satu perhitungan index + satu baca flash. Nilai di luar range di-clamp ke
+// cell tepi. Data grid di-generate oleh tools/knn_grid_build.cpp.
+
+static constexpr int KNN_GRID_BITS_PER_CELL = 2;
+static constexpr int KNN_GRID_CELLS_PER_BYTE = 8 / KNN_GRID_BITS_PER_CELL;
+
+template <int D>
+struct KnnGridLayout {
+    float rangeMin[D];
+    float rangeMax[D];
+    uint16_t bins[D];
+    float scale[D];      // bins / (max - min), supaya lookup tanpa divide
+    uint32_t stride[D];  // index cell = sum(bin[f] * stride[f])
+    uint32_t numCells;
+};
+
+template <int D>
+constexpr KnnGridLayout<D> knnMakeGridLayout(const float (&rangeMin)[D], const float (&rangeMax)[D],
+                                             const uint16_t (&bins)[D]) {
+    KnnGridLayout<D> layout{};
+    uint32_t stride = 1;
+    for (int f = D - 1; f >= 0; f--) {
+        layout.rangeMin[f] = rangeMin[f];
+        layout.rangeMax[f] = rangeMax[f];
+        layout.bins[f] = bins[f];
+        layout.scale[f] = float(bins[f]) / (rangeMax[f] - rangeMin[f]);
+        layout.stride[f] = stride;
+        stride *= bins[f];
+    }
+    layout.numCells = stride;
+    return layout;
+}
+
+template <int D>
+constexpr uint32_t knnGridPackedBytes(const KnnGridLayout<D>& layout) {
+    return (layout.numCells + KNN_GRID_CELLS_PER_BYTE - 1) / KNN_GRID_CELLS_PER_BYTE;
+}
+
+template <int D>
+inline uint32_t knnGridCellIndex(const KnnGridLayout<D>& layout, const float* raw) {
+    uint32_t cell = 0;
+    for (int f = 0; f < D; f++) {
+        float pos = (raw[f] - layout.rangeMin[f]) * layout.scale[f];
+        int32_t bin = pos > 0 ? int32_t(pos) : 0;
+        if (bin >= layout.bins[f]) bin = layout.bins[f] - 1;
+        cell += uint32_t(bin) * layout.stride[f];
+    }
+    return cell;
+}
+
+// Titik tengah cell untuk dimensi f (dipakai generator saat menghitung KNN)
+template <int D>
+constexpr float knnGridBinCenter(const KnnGridLayout<D>& layout, int f, uint32_t bin) {
+    return layout.rangeMin[f] + (float(bin) + 0.5f) * (layout.rangeMax[f] - layout.rangeMin[f]) / layout.bins[f];
+}
+
+inline uint8_t knnGridReadCode(const uint8_t* packed, uint32_t cell) {
+    const uint32_t shift = (cell % KNN_GRID_CELLS_PER_BYTE) * KNN_GRID_BITS_PER_CELL;
+    return (packed[cell / KNN_GRID_CELLS_PER_BYTE] >> shift) & ((1u << KNN_GRID_BITS_PER_CELL) - 1);
+}
+
+inline void knnGridWriteCode(uint8_t* packed, uint32_t cell, uint8_t code) {
+    const uint32_t shift = (cell % KNN_GRID_CELLS_PER_BYTE) * KNN_GRID_BITS_PER_CELL;
+    const uint8_t mask = uint8_t(((1u << KNN_GRID_BITS_PER_CELL) - 1) << shift);
+    packed[cell / KNN_GRID_CELLS_PER_BYTE] = uint8_t((packed[cell / KNN_GRID_CELLS_PER_BYTE] & ~mask) |
+                                                     ((code << shift) & mask));
+}
+
+template <int D>
+inline int knnGridLookup(const KnnGridLayout<D>& layout, const uint8_t* packed, const float* raw) {
+    return knnGridReadCode(packed, knnGridCellIndex(layout, raw));
+}
+
+#endif // KNN_DECISION_GRID_H
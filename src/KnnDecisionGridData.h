@@ -0,0 +1,4128 @@
+#ifndef KNN_DECISION_GRID_DATA_H
+#define KNN_DECISION_GRID_DATA_H
+
+// KnnDecisionGridData.h
+// GENERATED oleh tools/knn_grid_build.cpp - jangan diedit manual.
+// Keputusan KNN (K=3, 200 sampel) di titik tengah setiap cell,
+// 262144 cells x 2 bit = 65536 bytes. Error hybrid vs KNN exact:
+// near-data 0.672%, uniform 4.287%.
+
+#include <stdint.h>
+#include "KnnDecisionGrid.h"
+
+struct KnnDecisionGridData {
+    static constexpr int NUM_FEATURES = 5;
+    static constexpr float rangeMin[NUM_FEATURES] = {10.0f, 0.0f, -40.0f, 0.0f, 0.0f};
+    static constexpr float rangeMax[NUM_FEATURES] = {20.0f, 8000.0f, 150.0f, 100.0f, 250.0f};
+    static constexpr uint16_t bins[NUM_FEATURES] = {16, 16, 16, 8, 8};
+
+    static constexpr KnnGridLayout<NUM_FEATURES> layout =
+        knnMakeGridLayout(rangeMin, rangeMax, bins);
+
+    // Error hybrid vs KNN exact (%), ditampilkan saat backend GRID dipilih
+    static constexpr float NEAR_ERROR_PERCENT = 0.672f;
+    static constexpr float UNIFORM_ERROR_PERCENT = 4.287f;
+
+    static constexpr uint32_t NUM_BYTES = 65536;
+    static constexpr uint8_t codes[NUM_BYTES] = {
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xf9, 0x55, 0xf9, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf9, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0x6a, 0xff, 0xea, 0xff, 0xda, 0xff, 0xfa, 0xff, 0xfe, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf9, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf9, 0xff, 0xfd, 0xff,
+      0xaa, 0xfe, 0x6a, 0xff, 0xea, 0xff, 0xda, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf9, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xff, 0xff,
+      0xe5, 0xff, 0xe5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff,
+      0x55, 0xff, 0x55, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xe9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfe, 0xff,
+      0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xe9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+      0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff,
+      0x55, 0xff, 0x55, 0xff, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+      0xd5, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf9, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff,
+      0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff,
+      0x55, 0xfc, 0x55, 0xff, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xd5, 0xff, 0xc5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xfc, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x55, 0xff, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0xd5, 0xff, 0xc5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x15, 0xff, 0xc5, 0xff, 0xc5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc5, 0xff, 0xc5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfd, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xfd, 0x55, 0xfc, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xfc, 0x55, 0xff, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x15, 0xff, 0xc5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xd5, 0xff, 0xc5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc5, 0xff, 0xc5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc1, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf1, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xfc, 0x15, 0xff, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff,
+      0x15, 0xff, 0x15, 0xff, 0xc5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0xff, 0x05, 0xff, 0xc5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc5, 0xff, 0xf1, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf1, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x15, 0xff, 0x15, 0xff, 0xc5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0xff, 0x05, 0xff, 0xc1, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc1, 0xff, 0xc1, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf1, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0xff, 0x05, 0xff, 0xc1, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xff, 0xc1, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xff, 0xc1, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x59, 0xfa, 0x59, 0xfa, 0x59, 0xfa, 0x59, 0xfd, 0x59, 0xfd, 0x59, 0xff, 0xd9, 0xff, 0xf9, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x99, 0xfa, 0x99, 0xfe, 0x99, 0xfd, 0x59, 0xff, 0x59, 0xff, 0xd9, 0xff, 0xf9, 0xff, 0xf9, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf9, 0xff,
+      0x99, 0xfe, 0x99, 0xff, 0x59, 0xff, 0xd9, 0xff, 0xd9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfe, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfe, 0xff,
+      0xa9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfe, 0xff,
+      0x65, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfc, 0xff,
+      0xe9, 0xff, 0xe9, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xfc, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xfc, 0xff,
+      0xe5, 0xff, 0xe5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff,
+      0x55, 0xfc, 0x55, 0xfc, 0x15, 0xff, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xff, 0x15, 0xff, 0x15, 0xff, 0xc5, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xfd, 0xff, 0xfc, 0xff,
+      0xe5, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xfc, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xf5, 0xff,
+      0x55, 0xfc, 0x55, 0xfc, 0x15, 0xfc, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xf1, 0xff,
+      0x55, 0xfc, 0x15, 0xff, 0x15, 0xff, 0x05, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x15, 0xff, 0x05, 0xff, 0x05, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xc9, 0xff, 0xc9, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xff, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xfc, 0x55, 0xfc, 0x15, 0xff, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xf1, 0xff,
+      0x15, 0xfc, 0x15, 0xfc, 0x05, 0xff, 0x05, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x15, 0xfc, 0x05, 0xff, 0x05, 0xff, 0xc1, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x05, 0xff, 0x05, 0xff, 0xc1, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc2, 0xff, 0xc2, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xff, 0xd5, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xfc, 0x15, 0xff, 0xd5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xfc, 0x55, 0xfc, 0x15, 0xfc, 0x15, 0xff, 0xc5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+      0x15, 0xfc, 0x15, 0xff, 0x05, 0xff, 0x05, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0xfd, 0xff, 0xfc, 0xff,
+      0x05, 0xfc, 0x05, 0xff, 0x05, 0xff, 0xc1, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x01, 0xff, 0x01, 0xff, 0xc1, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x01, 0xff, 0xc1, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x02, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf2, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfc, 0x15, 0xfc, 0x15, 0xff, 0xc5, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0x55, 0xf0, 0x55, 0xfc, 0x15, 0xfc, 0x15, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xff, 0xff,
+      0x15, 0xfc, 0x15, 0xfc, 0x05, 0xff, 0x05, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff,
+      0x05, 0xfc, 0x05, 0xff, 0x05, 0xff, 0xc1, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x01, 0xff, 0x01, 0xff, 0x01, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xf0, 0x55, 0xfc, 0x15, 0xfc, 0x15, 0xff, 0xf5, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xff, 0xff,
+      0x15, 0xfc, 0x15, 0xfc, 0x05, 0xff, 0x05, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff,
+      0x05, 0xfc, 0x05, 0xff, 0x05, 0xff, 0xc1, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x01, 0xff, 0x01, 0xff, 0x01, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x01, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x15, 0xfc, 0x15, 0xfc, 0x05, 0xff, 0x05, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0xfc, 0x05, 0xff, 0x01, 0xff, 0xc1, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xfc, 0x01, 0xff, 0x01, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0xfc, 0x05, 0xff, 0x01, 0xff, 0xc1, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xfc, 0x01, 0xff, 0xc1, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xfc, 0x01, 0xff, 0xc1, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf9, 0x55, 0xf9, 0x55, 0xf9, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x05, 0xff,
+      0xa9, 0xfa, 0xa9, 0xfa, 0xa9, 0xfa, 0xa9, 0xfe, 0xa9, 0xfe, 0x69, 0xff, 0x19, 0xff, 0xc9, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xca, 0xff, 0xca, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xca, 0xff, 0xca, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xce, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x15, 0xff,
+      0x55, 0xf9, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff, 0x09, 0xff,
+      0xa9, 0xfa, 0xa9, 0xfa, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xff, 0x29, 0xff, 0xc9, 0xff, 0xc1, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xca, 0xff, 0xf2, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xca, 0xff, 0xf2, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xf2, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf2, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x15, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff, 0x09, 0xff,
+      0x55, 0xfe, 0x55, 0xfe, 0x55, 0xfe, 0x55, 0xfd, 0x55, 0xff, 0x15, 0xff, 0xc5, 0xff, 0xc1, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xc0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf3, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfc, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x15, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x15, 0xff, 0x05, 0xff,
+      0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0x05, 0xff, 0x01, 0xff,
+      0x55, 0xfe, 0x55, 0xfe, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xc5, 0xff, 0xc1, 0xff, 0xc0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0x6a, 0xff, 0xea, 0xff, 0xea, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0x15, 0xff,
+      0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0x15, 0xff, 0x05, 0xff,
+      0x55, 0xfd, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0x15, 0xff, 0x05, 0xff, 0xc1, 0xff,
+      0x55, 0xf1, 0x55, 0xfd, 0x55, 0xff, 0x55, 0xff, 0xd5, 0xff, 0xc5, 0xff, 0xc1, 0xff, 0xc0, 0xff,
+      0xa6, 0xff, 0xa6, 0xff, 0xe6, 0xff, 0xe6, 0xff, 0xe6, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xca, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xc5, 0x55, 0xfd, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xff, 0x15, 0xff, 0xf5, 0xff,
+      0x55, 0xf1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xfc, 0x55, 0xff, 0x15, 0xff, 0xc5, 0xff, 0xf1, 0xff,
+      0x55, 0xf0, 0x55, 0xf0, 0x55, 0xfc, 0x15, 0xff, 0x15, 0xff, 0xc5, 0xff, 0xc1, 0xff, 0xf0, 0xff,
+      0x55, 0xfc, 0x55, 0xff, 0xd5, 0xff, 0x15, 0xff, 0xc5, 0xff, 0xc9, 0xff, 0xc2, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xff, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xf1, 0x55, 0xf0, 0x55, 0xf0, 0x55, 0xfc, 0x15, 0xfc, 0x15, 0xff, 0xc5, 0xff, 0xf1, 0xff,
+      0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x15, 0xff, 0xc5, 0xff, 0xf1, 0xff, 0xf0, 0xff,
+      0x55, 0xf0, 0x15, 0xfc, 0x15, 0xff, 0x05, 0xff, 0xc5, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x2a, 0xff, 0x2a, 0xff, 0x2a, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0x2a, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd,
+      0x55, 0xd5, 0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xf5, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xfc, 0xd5, 0xff, 0xc5, 0xff,
+      0x55, 0xf1, 0x55, 0xf0, 0x55, 0xf0, 0x55, 0xfc, 0x15, 0xfc, 0x15, 0xff, 0xc5, 0xff, 0xf1, 0xff,
+      0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x15, 0xfc, 0xc5, 0xff, 0xf1, 0xff, 0xf0, 0xff,
+      0x15, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x05, 0xfc, 0x05, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x25, 0xfc, 0x05, 0xfc, 0x09, 0xff, 0x09, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x2a, 0xff, 0x0a, 0xff, 0x02, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xd5, 0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xff,
+      0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfd, 0x55, 0xfc, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfc, 0x55, 0xfc, 0x55, 0xfc, 0x15, 0xff, 0xc5, 0xff,
+      0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfc, 0x55, 0xfc, 0x15, 0xfc, 0x15, 0xff, 0xc5, 0xff, 0xf1, 0xff,
+      0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x15, 0xfc, 0x05, 0xff, 0xc1, 0xff, 0xf0, 0xff,
+      0x15, 0xf0, 0x15, 0xfc, 0x05, 0xfc, 0x05, 0xfc, 0x05, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x05, 0xf0, 0x05, 0xfc, 0x01, 0xfc, 0x01, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x0a, 0xfc, 0x0a, 0xfc, 0x02, 0xff, 0x02, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x0a, 0xfc, 0x02, 0xff, 0x02, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xca, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfc, 0x55, 0xff, 0xd5, 0xff,
+      0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfc, 0x55, 0xfc, 0x55, 0xfc, 0xd5, 0xff, 0xc5, 0xff,
+      0x55, 0xf1, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x15, 0xff, 0xc5, 0xff, 0xc1, 0xff,
+      0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x15, 0xfc, 0xc5, 0xff, 0xc1, 0xff, 0xf0, 0xff,
+      0x15, 0xf0, 0x15, 0xfc, 0x05, 0xfc, 0x05, 0xfc, 0x05, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x05, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x01, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xfc, 0x01, 0xfc, 0x01, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x02, 0xfc, 0x02, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x02, 0xff, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc2, 0xff, 0xc2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xfc, 0x55, 0xfc, 0xd5, 0xff, 0xf5, 0xff,
+      0x55, 0xf0, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0xd5, 0xff, 0xc5, 0xff, 0xf1, 0xff,
+      0x55, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x05, 0xfc, 0xc5, 0xff, 0xf1, 0xff, 0xf1, 0xff,
+      0x15, 0xf0, 0x15, 0xfc, 0x05, 0xfc, 0x05, 0xfc, 0x05, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x05, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x01, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xfc, 0x01, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x02, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xc0, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0xd5, 0xff, 0xf5, 0xff, 0xf1, 0xff,
+      0x55, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x05, 0xfc, 0xc5, 0xff, 0xf1, 0xff, 0xf0, 0xff,
+      0x15, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x05, 0xfc, 0x05, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x05, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x01, 0xff, 0xc1, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xfc, 0x01, 0xfc, 0x01, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x05, 0xfc, 0x05, 0xfc, 0xf5, 0xff, 0xf1, 0xff, 0xfc, 0xff,
+      0x15, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x05, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x05, 0xf0, 0x05, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0xf1, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x01, 0xfc, 0x01, 0xfc, 0x01, 0xff, 0x01, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x01, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x15, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x05, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x05, 0xf0, 0x05, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0xc1, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x01, 0xf0, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x01, 0xfc, 0x01, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0xf0, 0x05, 0xfc, 0x01, 0xfc, 0x01, 0xff, 0xc1, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x01, 0xf0, 0x01, 0xfc, 0x01, 0xfc, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x01, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xf0, 0x01, 0xfc, 0x01, 0xfc, 0x00, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfc,
+      0x55, 0x95, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfc, 0x15, 0xfc,
+      0x55, 0xe9, 0x55, 0xe9, 0x55, 0xf9, 0x55, 0xf9, 0x55, 0xfd, 0x55, 0xfc, 0x15, 0xfc, 0x05, 0xff,
+      0x99, 0xea, 0x99, 0xea, 0x99, 0xfa, 0x99, 0xfa, 0x99, 0xfe, 0x19, 0xfc, 0x09, 0xff, 0x01, 0xff,
+      0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfc, 0x0a, 0xff, 0x02, 0xff,
+      0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfc, 0x0a, 0xff, 0x02, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0x2a, 0xff, 0x02, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xca, 0xff, 0xc2, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xc2, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfc,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfc, 0x15, 0xfc,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfc, 0x15, 0xfc, 0x05, 0xfc,
+      0x55, 0xea, 0x55, 0xfa, 0x55, 0xfa, 0x55, 0xfe, 0x55, 0xfd, 0x55, 0xfc, 0x05, 0xff, 0x01, 0xff,
+      0xa9, 0xea, 0xa9, 0xfa, 0xa9, 0xfa, 0xa9, 0xfe, 0x69, 0xfc, 0x19, 0xfc, 0x09, 0xff, 0x02, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfc, 0x0a, 0xff, 0x0a, 0xff, 0x00, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0x2a, 0xff, 0x0a, 0xff, 0xc0, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0x2a, 0xff, 0x02, 0xff, 0xc2, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xc2, 0xff, 0xc0, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xc2, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfd,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfc,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfc, 0x15, 0xfc,
+      0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfc, 0x15, 0xfc, 0x05, 0xff,
+      0x55, 0xf5, 0x55, 0xc5, 0x55, 0xfd, 0x55, 0xf1, 0x55, 0xfc, 0x55, 0xfc, 0x05, 0xfc, 0x01, 0xff,
+      0x55, 0xfa, 0x55, 0xfe, 0x55, 0xfe, 0x55, 0xfd, 0x55, 0xfc, 0x05, 0xfc, 0x01, 0xff, 0x02, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfc, 0x2a, 0xfc, 0x0a, 0xff, 0x02, 0xff, 0x00, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfc, 0x0a, 0xfc, 0x0a, 0xff, 0x02, 0xff, 0x00, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0x0a, 0xff, 0x0a, 0xff, 0xc2, 0xff, 0xc0, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xc2, 0xff, 0xc2, 0xff, 0xc0, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xc2, 0xff, 0xc0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfc,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xfd, 0x55, 0xfc, 0x15, 0xfc,
+      0x55, 0xf5, 0x55, 0xf5, 0x55, 0xc5, 0x55, 0xfd, 0x55, 0xfd, 0x55, 0xfc, 0x15, 0xfc, 0x05, 0xfc,
+      0x55, 0xc5, 0x55, 0xc5, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfc, 0x15, 0xfc, 0x05, 0xfc, 0x05, 0xff,
+      0x55, 0xcd, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfc, 0x55, 0xfc, 0x15, 0xfc, 0x01, 0xff, 0x00, 0xff,
+      0xa6, 0xfe, 0xa6, 0xf1, 0xa6, 0xf0, 0x66, 0xfc, 0x16, 0xfc, 0x0a, 0xff, 0x02, 0xff, 0x00, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfc, 0x2a, 0xfc, 0x0a, 0xfc, 0x02, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0x2a, 0xfc, 0x0a, 0xff, 0x02, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xc2, 0xff, 0xc0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xc2, 0xff, 0xc0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfc,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfc, 0x55, 0xfc,
+      0x55, 0xf5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xfd, 0x55, 0xf1, 0x55, 0xfc, 0x55, 0xfc, 0x15, 0xfc,
+      0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xfc, 0x15, 0xfc, 0x05, 0xfc, 0x01, 0xfc,
+      0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf0, 0x15, 0xfc, 0x05, 0xfc, 0x01, 0xff, 0x00, 0xff,
+      0x55, 0xc1, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x05, 0xff, 0x02, 0xff, 0x00, 0xff,
+      0xaa, 0xf2, 0xaa, 0xf0, 0x2a, 0xf0, 0x2a, 0xfc, 0x0a, 0xfc, 0x02, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xf2, 0xaa, 0xfc, 0x2a, 0xff, 0x2a, 0xff, 0x0a, 0xff, 0x02, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfc, 0x2a, 0xff, 0x0a, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xca, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xfc, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf1,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xfc,
+      0x55, 0x15, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xfc,
+      0x55, 0xf5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xfc, 0x15, 0xfc,
+      0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x05, 0xfc,
+      0x55, 0xc0, 0x55, 0xc0, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x05, 0xfc, 0x05, 0xfc, 0x01, 0xff,
+      0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0xa6, 0xc0, 0x26, 0xf0, 0x26, 0xf0, 0x06, 0xfc, 0x0a, 0xff, 0x02, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xf0, 0x2a, 0xf0, 0x2a, 0xfc, 0x0a, 0xff, 0x02, 0xff, 0x02, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0xaa, 0xf0, 0x2a, 0xfc, 0x2a, 0xff, 0x0a, 0xff, 0x02, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0xaa, 0xfc, 0x2a, 0xff, 0x2a, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xca, 0xff, 0xca, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf1,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xf1,
+      0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfc,
+      0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xfc, 0x15, 0xfc,
+      0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xf0, 0x55, 0xfc, 0x15, 0xfc, 0x05, 0xfc,
+      0x55, 0xc0, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x15, 0xfc, 0x05, 0xfc, 0x01, 0xff,
+      0x55, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x01, 0xfc, 0x01, 0xff, 0xc0, 0xff,
+      0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x2a, 0xf0, 0x2a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xff, 0x02, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x2a, 0xf0, 0x2a, 0xfc, 0x0a, 0xfc, 0x02, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x2a, 0xf0, 0x0a, 0xfc, 0x0a, 0xff, 0xca, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x2a, 0xfc, 0xea, 0xff, 0xca, 0xff, 0xfa, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0xea, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x15, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf5, 0x55, 0xf1,
+      0x55, 0x15, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfc,
+      0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xfc, 0x15, 0xfc,
+      0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xf0, 0x55, 0xfc, 0x15, 0xfc, 0x05, 0xff,
+      0x55, 0xc0, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x05, 0xfc, 0x01, 0xff,
+      0x55, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x01, 0xfc, 0x01, 0xff, 0xc0, 0xff,
+      0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x01, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x06, 0xf0, 0x06, 0xf0, 0x06, 0xfc, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x0a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x0a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x0a, 0xfc, 0x0a, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x0a, 0xfc, 0xca, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x15, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xf5, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xfc,
+      0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xfc, 0x15, 0xfc,
+      0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x05, 0xfc,
+      0x55, 0xc0, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x05, 0xfc, 0x01, 0xff,
+      0x55, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x05, 0xfc, 0x01, 0xff, 0xc0, 0xff,
+      0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x05, 0xf0, 0x05, 0xf0, 0x01, 0xfc, 0x01, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x0a, 0xf0, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x0a, 0xf0, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x0a, 0xfc, 0x02, 0xff, 0x02, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xca, 0xff, 0xca, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xf1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xff,
+      0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf0, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xfc, 0x15, 0xff,
+      0x55, 0xc0, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x05, 0xff, 0x01, 0xff,
+      0x15, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x01, 0xff, 0xc0, 0xff,
+      0x15, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x01, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x05, 0xf0, 0x05, 0xf0, 0x01, 0xfc, 0x01, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x01, 0xf0, 0x01, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x02, 0xfc, 0x02, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x02, 0xfc, 0x02, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xca, 0xff, 0xc2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf2, 0xff, 0xf2, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0xd5, 0xff,
+      0x55, 0xc0, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xfc, 0x05, 0xff, 0xc1, 0xff,
+      0x15, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0xc1, 0xff, 0xc0, 0xff,
+      0x15, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x01, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x05, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x01, 0xf0, 0x01, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x02, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc2, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0xc0, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0xd5, 0xff, 0xc1, 0xff,
+      0x15, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0xc1, 0xff, 0xf0, 0xff,
+      0x15, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x05, 0xfc, 0x01, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x05, 0xc0, 0x05, 0xf0, 0x01, 0xfc, 0x01, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xf0, 0x01, 0xf0, 0x01, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x15, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0xf1, 0xff, 0xf0, 0xff,
+      0x15, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x01, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x05, 0xc0, 0x05, 0xf0, 0x01, 0xf0, 0x01, 0xfc, 0x00, 0xfc, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xf0, 0x01, 0xf0, 0x01, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xf0, 0x05, 0xfc, 0x01, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x05, 0xc0, 0x05, 0xf0, 0x01, 0xf0, 0x01, 0xfc, 0x01, 0xfc, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xf0, 0x01, 0xf0, 0x01, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0xc0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xfc, 0x01, 0xfc, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x01, 0xf0, 0x01, 0xf0, 0x01, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xc0, 0x01, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc1,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0x15, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc0,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x15, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc0, 0x15, 0xc0,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0xf5, 0x55, 0xc5, 0x55, 0xf9, 0x55, 0xf1, 0x55, 0xf0, 0x05, 0xfc,
+      0x55, 0xe9, 0x55, 0x29, 0x55, 0xe9, 0x55, 0xc9, 0x55, 0xf1, 0x55, 0xf0, 0x15, 0xf0, 0x01, 0xfc,
+      0x99, 0xea, 0x99, 0xea, 0x99, 0xfa, 0x99, 0xfa, 0x99, 0xf2, 0x99, 0xf0, 0x09, 0xf0, 0x01, 0xfc,
+      0xaa, 0xea, 0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xf2, 0xaa, 0xfc, 0x0a, 0xfc, 0x02, 0xfc,
+      0xaa, 0xea, 0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xf8, 0xaa, 0xfc, 0x0a, 0xfc, 0x02, 0xfc,
+      0xaa, 0xea, 0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xf8, 0xaa, 0xfc, 0x0a, 0xfc, 0x02, 0xfc,
+      0xaa, 0xea, 0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfc, 0x2a, 0xfc, 0x0a, 0xff, 0x02, 0xff,
+      0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0x0a, 0xff, 0x02, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc1,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc0,
+      0x55, 0xd5, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x15, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc0, 0x15, 0xf0,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x35, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xf0, 0x15, 0xf0, 0x05, 0xfc,
+      0x55, 0x25, 0x55, 0x35, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf0, 0x05, 0xf0, 0x01, 0xfc,
+      0x55, 0x29, 0x55, 0xf9, 0x55, 0xc9, 0x55, 0xc1, 0x55, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xfc,
+      0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xf2, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xff,
+      0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfc, 0x2a, 0xff, 0x02, 0xff, 0x00, 0xff,
+      0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0x2a, 0xff, 0xc2, 0xff, 0xc2, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xc5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0xc5, 0x55, 0xc1,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xf0,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x15, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xf0,
+      0x55, 0xd5, 0x55, 0x15, 0x55, 0x35, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xf0, 0x55, 0xf0, 0x05, 0xf0,
+      0x55, 0x35, 0x55, 0x05, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xf1, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xfc,
+      0x55, 0x05, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xfc,
+      0x95, 0x0a, 0x95, 0xc2, 0x95, 0xf2, 0x95, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xfc, 0x00, 0xfc,
+      0xaa, 0xfa, 0xaa, 0xca, 0xaa, 0xf2, 0xaa, 0xf0, 0x0a, 0xf0, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xff, 0x00, 0xff,
+      0xaa, 0xfa, 0xaa, 0xf2, 0xaa, 0xfe, 0xaa, 0xfe, 0x2a, 0xff, 0x0a, 0xff, 0x02, 0xff, 0x00, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xc0, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xc5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0xc5, 0x55, 0xc1,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc1,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x15, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf0,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x35, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x05, 0xf0,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xfc,
+      0x55, 0x01, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xf0, 0x00, 0xfc,
+      0xaa, 0x02, 0xaa, 0xc0, 0xaa, 0xf0, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc2, 0xaa, 0xc2, 0xaa, 0xf0, 0x2a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc2, 0xaa, 0xf2, 0xaa, 0xf2, 0x0a, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xf2, 0xaa, 0xfa, 0xaa, 0xfc, 0x0a, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xf2, 0xaa, 0xf2, 0xaa, 0xfc, 0x2a, 0xfc, 0x0a, 0xfc, 0x02, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xf2, 0xaa, 0xfa, 0xaa, 0xfe, 0x2a, 0xff, 0x0a, 0xff, 0x02, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xfa, 0xaa, 0xfe, 0xaa, 0xff, 0xea, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xc2, 0xff, 0xc0, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc1,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x15, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc0,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc0, 0x15, 0xf0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x05, 0xf0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xfc,
+      0x55, 0x01, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xf0, 0x00, 0xfc,
+      0xa6, 0xc0, 0xa6, 0xc0, 0x26, 0xc0, 0x26, 0xc0, 0x06, 0xf0, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc0, 0xaa, 0xc0, 0x2a, 0xf0, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc2, 0xaa, 0xf0, 0x2a, 0xf0, 0x0a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0xaa, 0xc2, 0xaa, 0xf2, 0x2a, 0xf0, 0x0a, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xf2, 0xaa, 0xf0, 0x2a, 0xfc, 0x0a, 0xfc, 0x0a, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xf2, 0xaa, 0xfc, 0x2a, 0xfc, 0x0a, 0xfc, 0x0a, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xff, 0x0a, 0xff, 0x0a, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0xaa, 0xfe, 0xaa, 0xff, 0xaa, 0xff, 0xca, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc1,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc0,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc0, 0x15, 0xf0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf0, 0x15, 0xf0, 0x05, 0xf0,
+      0x55, 0x01, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xf0,
+      0x55, 0x00, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xf0, 0x00, 0xfc,
+      0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0, 0x05, 0xc0, 0x05, 0xf0, 0x01, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc0, 0x2a, 0xc0, 0x2a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc0, 0x2a, 0xc0, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0xaa, 0xc0, 0xaa, 0xf0, 0x2a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xf0, 0x2a, 0xf0, 0x2a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xf0, 0x2a, 0xf0, 0x2a, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0xaa, 0xf0, 0xaa, 0xfc, 0x0a, 0xfc, 0x0a, 0xff, 0x02, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xea, 0xff, 0x0a, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xaa, 0xff, 0xaa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc1,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0xd5, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc0,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xf0,
+      0x55, 0x05, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0,
+      0x55, 0x01, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xf0,
+      0x55, 0xc0, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xf0, 0x01, 0xfc,
+      0x15, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xfc,
+      0x16, 0xc0, 0x06, 0xc0, 0x06, 0xf0, 0x06, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x2a, 0xc0, 0x2a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x2a, 0xc0, 0x2a, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x2a, 0xf0, 0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0xaa, 0xf0, 0x0a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x2a, 0xfc, 0x2a, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0xaa, 0xfc, 0x2a, 0xfc, 0x0a, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xea, 0xff, 0x0a, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0xd5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xf1,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xf0, 0x55, 0xf0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xf0,
+      0x55, 0x01, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0,
+      0x55, 0xc0, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xf0, 0x01, 0xf0,
+      0x15, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xfc,
+      0x15, 0xc0, 0x05, 0xc0, 0x05, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xfc, 0x00, 0xff,
+      0x0a, 0xc0, 0x06, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x0a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x2a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x2a, 0xfc, 0x0a, 0xfc, 0x02, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x2a, 0xfc, 0x0a, 0xff, 0xc2, 0xff, 0xc2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xea, 0xff, 0xca, 0xff, 0xc2, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xfa, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xf1, 0x55, 0xf0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xf0,
+      0x55, 0x01, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0,
+      0x55, 0x00, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xf0, 0x01, 0xfc,
+      0x15, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xfc,
+      0x15, 0xc0, 0x05, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x05, 0xc0, 0x05, 0xf0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x0a, 0xc0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x0a, 0xf0, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x0a, 0xff, 0xc2, 0xff, 0xc2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0xca, 0xff, 0xfa, 0xff, 0xf2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xf0, 0x55, 0xf0, 0x15, 0xf0,
+      0x55, 0x01, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xfc,
+      0x55, 0x00, 0x55, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xfc,
+      0x15, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x01, 0xf0, 0x01, 0xfc, 0x00, 0xff,
+      0x05, 0xc0, 0x05, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0x00, 0xff,
+      0x05, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x01, 0xc0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x02, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x02, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x02, 0xfc, 0x02, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x0a, 0xfc, 0x02, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xc2, 0xff, 0xc2, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf2, 0xff, 0xf2, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xf0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xff,
+      0x55, 0x00, 0x55, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xff,
+      0x15, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xf0, 0x01, 0xfc, 0x00, 0xff,
+      0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xf0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0x00, 0xff,
+      0x05, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x01, 0xc0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x02, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x02, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc2, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf2, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x15, 0xf0, 0x05, 0xf0, 0x01, 0xff,
+      0x15, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xf0, 0x05, 0xf0, 0x05, 0xf0, 0x01, 0xfc, 0xc0, 0xff,
+      0x15, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x00, 0xf0, 0xc0, 0xff, 0xc0, 0xff,
+      0x05, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x15, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x05, 0xf0, 0x01, 0xfc, 0xc0, 0xff,
+      0x15, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x05, 0x00, 0x05, 0xc0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x15, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xf0, 0x05, 0xf0, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff,
+      0x05, 0xc0, 0x01, 0xc0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xf0, 0xff, 0xf0, 0xff,
+      0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x95, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xc0, 0x15, 0xc0,
+      0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x05, 0x55, 0x01, 0x55, 0xc0, 0x15, 0xc0, 0x05, 0xc0,
+      0x55, 0x29, 0x55, 0x29, 0x55, 0x09, 0x55, 0x09, 0x55, 0xc2, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0,
+      0xa5, 0x2a, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0xca, 0xa5, 0xc2, 0x25, 0xc0, 0x05, 0xf0, 0x01, 0xf0,
+      0xaa, 0x2a, 0xaa, 0xea, 0xaa, 0xca, 0xaa, 0xca, 0xaa, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x2a, 0xaa, 0xea, 0xaa, 0xca, 0xaa, 0xca, 0xaa, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x2a, 0xaa, 0xea, 0xaa, 0xca, 0xaa, 0xfa, 0xaa, 0xf0, 0x2a, 0xf0, 0x02, 0xf0, 0x00, 0xfc,
+      0xaa, 0x2a, 0xaa, 0xea, 0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xf0, 0x2a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc,
+      0xaa, 0x2a, 0xaa, 0xea, 0xaa, 0xea, 0xaa, 0xfa, 0xaa, 0xf8, 0x2a, 0xfc, 0x0a, 0xfc, 0x02, 0xfc,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0xc0, 0x15, 0xc0,
+      0x55, 0x25, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0xc0, 0x15, 0xc0, 0x05, 0xc0,
+      0x55, 0x29, 0x55, 0x09, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0,
+      0x55, 0x0a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x02, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0xc2, 0x2a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0xca, 0xaa, 0xc0, 0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x2a, 0xaa, 0xca, 0xaa, 0xca, 0xaa, 0xf0, 0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x2a, 0xaa, 0xca, 0xaa, 0xca, 0xaa, 0xc0, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xfc,
+      0xaa, 0xea, 0xaa, 0xca, 0xaa, 0xc2, 0xaa, 0xf2, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xea, 0xaa, 0xca, 0xaa, 0xf2, 0xaa, 0xf2, 0x2a, 0xfc, 0x2a, 0xfc, 0x02, 0xfc, 0x02, 0xfc,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0xc0,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0xc0, 0x15, 0xc0, 0x05, 0xc0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x00, 0xf0,
+      0x96, 0x0a, 0x96, 0x02, 0x96, 0x02, 0x16, 0x00, 0x06, 0xc0, 0x06, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0xc2, 0x2a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x0a, 0xaa, 0xca, 0xaa, 0xc2, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x0a, 0xaa, 0xc2, 0xaa, 0xc2, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0xaa, 0xca, 0xaa, 0xc2, 0xaa, 0xc2, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xca, 0xaa, 0xc2, 0xaa, 0xf2, 0xaa, 0xf0, 0x0a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc,
+      0xaa, 0xca, 0xaa, 0xf2, 0xaa, 0xf2, 0xaa, 0xfc, 0x2a, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0xd5, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0xc0,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0xc0, 0x05, 0xc0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x01, 0xc0, 0x00, 0xf0,
+      0x56, 0x01, 0x56, 0x00, 0x56, 0x00, 0x16, 0x00, 0x06, 0xc0, 0x06, 0xc0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0xc0, 0x0a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x02, 0xaa, 0xc2, 0xaa, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0xaa, 0x02, 0xaa, 0xc2, 0xaa, 0xc0, 0x0a, 0xf0, 0x0a, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc2, 0xaa, 0xc2, 0xaa, 0xf0, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc2, 0xaa, 0xc2, 0xaa, 0xf0, 0x2a, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc2, 0xaa, 0xf2, 0xaa, 0xf0, 0xaa, 0xfc, 0x0a, 0xfc, 0x0a, 0xff, 0x02, 0xff, 0x00, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x15, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x05, 0xc0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xc0,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x00, 0xf0,
+      0x96, 0x00, 0x16, 0x00, 0x16, 0x00, 0x06, 0x00, 0x06, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0xaa, 0x00, 0x2a, 0xc0, 0x2a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0xaa, 0xc0, 0xaa, 0xc0, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc2, 0xaa, 0xc0, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc2, 0xaa, 0xf0, 0xaa, 0xf0, 0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0xaa, 0xf2, 0xaa, 0xf0, 0xaa, 0xfc, 0x0a, 0xfc, 0x0a, 0xfc, 0x02, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0xc0,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0xc1, 0x55, 0xc0, 0x15, 0xc0,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0, 0x05, 0xc0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xc0,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x00, 0xf0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0x00, 0x2a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0x00, 0x2a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0xaa, 0x00, 0x2a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0x00, 0x2a, 0xc0, 0x2a, 0xc0, 0x0a, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc0, 0x2a, 0xc0, 0x0a, 0xf0, 0x0a, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xf0, 0x2a, 0xf0, 0x0a, 0xf0, 0x0a, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0xaa, 0xf0, 0x2a, 0xf0, 0x0a, 0xfc, 0x0a, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0xaa, 0xf0, 0xaa, 0xfc, 0x0a, 0xff, 0x0a, 0xff, 0x02, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0xc1,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xc0,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0xc1, 0x55, 0xc0, 0x15, 0xc0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0xc1, 0x55, 0xc0, 0x15, 0xc0, 0x05, 0xc0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x00, 0xc0, 0x00, 0xf0,
+      0x25, 0x00, 0x05, 0x00, 0x05, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0x00, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x2a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x2a, 0xf0, 0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x2a, 0xf0, 0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x2a, 0xf0, 0x0a, 0xfc, 0x0a, 0xfc, 0x02, 0xff, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0xaa, 0xfc, 0x0a, 0xff, 0x0a, 0xff, 0x02, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xc0,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xc0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc0, 0x15, 0xc0, 0x15, 0xc0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0xc0, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0, 0x05, 0xc0, 0x05, 0xc0,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+      0x15, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0,
+      0x05, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x0a, 0xc0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x0a, 0xfc, 0x0a, 0xfc, 0x02, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x0a, 0xff, 0x0a, 0xff, 0x02, 0xff, 0x02, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0xc5, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xc0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0xc1, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xf0,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xf0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xf0, 0x00, 0xf0,
+      0x05, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x0a, 0xff, 0x02, 0xff, 0x02, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x0a, 0xff, 0x02, 0xff, 0x02, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0xc1, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xf0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xf0,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x01, 0xf0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xf0,
+      0x15, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x05, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x01, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x02, 0xfc, 0x02, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x02, 0xff, 0x02, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0xc2, 0xff, 0xc2, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0xc0, 0x55, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xf0,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x01, 0xf0, 0x01, 0xf0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x01, 0xf0, 0x00, 0xf0,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x05, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff,
+      0x01, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x02, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xc2, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xc2, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x15, 0xc0, 0x05, 0xf0, 0x01, 0xf0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xf0, 0x00, 0xfc,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff,
+      0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xf0, 0x01, 0xf0, 0x00, 0xfc,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff,
+      0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0xc0, 0x05, 0xc0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff,
+      0x05, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff,
+      0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff,
+      0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x25, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x29, 0x55, 0x29, 0x55, 0x09, 0x55, 0x09, 0x55, 0x01, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x2a, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x0a, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0xc0,
+      0xa5, 0x2a, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x0a, 0xa5, 0x00, 0x25, 0x00, 0x05, 0xc0, 0x01, 0xc0,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0xc0, 0x2a, 0xc0, 0x02, 0xc0, 0x00, 0xc0,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0xca, 0xaa, 0xc2, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0xea, 0xaa, 0xca, 0xaa, 0xc2, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x09, 0x55, 0x09, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x0a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x02, 0x15, 0x00, 0x05, 0x00, 0x01, 0xc0, 0x00, 0xc0,
+      0xa6, 0x0a, 0xa6, 0x0a, 0xa6, 0x02, 0xa6, 0x00, 0x26, 0x00, 0x06, 0xc0, 0x02, 0xc0, 0x00, 0xc0,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xf0,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0xc2, 0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0xc2, 0x2a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0xca, 0xaa, 0xc2, 0x2a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xfc,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x0a, 0x55, 0x02, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0xc0, 0x00, 0xc0,
+      0x55, 0x02, 0x55, 0x02, 0x55, 0x02, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0xc2, 0xaa, 0xc0, 0x0a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0xc2, 0xaa, 0xc0, 0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xfc, 0x00, 0xfc,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0xc0, 0x00, 0xc0,
+      0x55, 0x02, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0xa6, 0x02, 0xa6, 0x00, 0x26, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0xc0, 0x2a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x02, 0xaa, 0xc2, 0xaa, 0xc0, 0x2a, 0xf0, 0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xfc, 0x00, 0xfc,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0,
+      0xa5, 0x00, 0x25, 0x00, 0x25, 0x00, 0x05, 0x00, 0x05, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x02, 0x2a, 0x00, 0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0xc2, 0xaa, 0xc0, 0x2a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0xaa, 0xc2, 0xaa, 0xc0, 0x2a, 0xc0, 0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x25, 0x00, 0x25, 0x00, 0x05, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0xc0, 0x2a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0xc0, 0x2a, 0xc0, 0x0a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0xaa, 0xc0, 0x2a, 0xc0, 0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x25, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x29, 0x00, 0x09, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x2a, 0xc0, 0x0a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x2a, 0xc0, 0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0xc0,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0xc0, 0x01, 0xc0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x09, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x0a, 0xc0, 0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x0a, 0xf0, 0x0a, 0xf0, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0xc0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x05, 0xc0,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x09, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x0a, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x0a, 0xf0, 0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x0a, 0xfc, 0x02, 0xfc, 0x02, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0xc0,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x05, 0xc0,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xc0,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff,
+      0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x02, 0xfc, 0x02, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0xc0, 0x15, 0xc0, 0x05, 0xc0,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0xc0, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x02, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x02, 0xff, 0x02, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0xc0, 0x15, 0xc0, 0x01, 0xc0, 0x01, 0xf0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xf0,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0xc0, 0x01, 0xc0, 0x01, 0xf0, 0x00, 0xf0,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0xc0, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x30, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x95, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x25, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x05, 0x00,
+      0x55, 0x2a, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x0a, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x95, 0x2a, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x0a, 0xa5, 0x00, 0x25, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0xc0, 0x00, 0xc0,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x05, 0x00,
+      0x55, 0x25, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x05, 0x00, 0x05, 0x00,
+      0x55, 0x0a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x02, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x00, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xf0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x05, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x0a, 0x55, 0x02, 0x55, 0x02, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x02, 0x95, 0x02, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xa9, 0x02, 0xa9, 0x00, 0x29, 0x00, 0x09, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0xc0, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xa5, 0x00, 0xa5, 0x00, 0x25, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x25, 0x00, 0x25, 0x00, 0x05, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x25, 0x00, 0x25, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0x00, 0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x2a, 0xc0, 0x0a, 0xc0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x0a, 0x00, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x0a, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xf0, 0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x02, 0xfc, 0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x02, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x02, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0xc0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xc0,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x01, 0xc0, 0x00, 0xc0,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xfc, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x95, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x25, 0x55, 0x25, 0x55, 0x25, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x05, 0x00,
+      0x55, 0x29, 0x55, 0x29, 0x55, 0x09, 0x55, 0x09, 0x55, 0x02, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x95, 0x2a, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x0a, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xa9, 0xaa, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x0a, 0xa9, 0x02, 0x29, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x95, 0x55, 0x15, 0x55, 0x25, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x25, 0x55, 0x05, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x2a, 0x55, 0x0a, 0x55, 0x0a, 0x55, 0x02, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x95, 0x2a, 0x95, 0x0a, 0x95, 0x0a, 0x95, 0x02, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x25, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x05, 0x00, 0x05, 0x00,
+      0x55, 0x09, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x95, 0x0a, 0x95, 0x02, 0x95, 0x02, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x02, 0xa5, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x02, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x02, 0x95, 0x02, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0xc0,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x55, 0x02, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xa6, 0x02, 0xa6, 0x00, 0x26, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xa6, 0x00, 0x26, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x25, 0x00, 0x25, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0x00, 0x09, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x02, 0xc0, 0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xf0, 0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+      0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xfc, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x95, 0x55, 0x15, 0x55, 0x25, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0xa9, 0x55, 0x29, 0x55, 0x29, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x95, 0xaa, 0x95, 0x2a, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x0a, 0xa5, 0x02, 0x25, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x95, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x95, 0x55, 0x15, 0x55, 0x25, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x2a, 0x55, 0x0a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x95, 0x2a, 0x95, 0x0a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x00, 0x29, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x25, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x0a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x95, 0x0a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x0a, 0x55, 0x02, 0x55, 0x02, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x02, 0x29, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x95, 0x02, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xa9, 0x02, 0xa9, 0x00, 0x29, 0x00, 0x29, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xa5, 0x00, 0x25, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x29, 0x00, 0x09, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x02, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xc0, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0xa9, 0x55, 0xa9, 0x55, 0x29, 0x55, 0x29, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0xaa, 0x55, 0x2a, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x0a, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x00, 0x05, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x06, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x95, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x29, 0x55, 0x29, 0x55, 0x29, 0x55, 0x09, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x95, 0x2a, 0x95, 0x2a, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0xa5, 0x2a, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x01, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x95, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x29, 0x55, 0x09, 0x55, 0x09, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x95, 0x2a, 0x95, 0x0a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x01, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x09, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00,
+      0x99, 0x0a, 0x99, 0x0a, 0x99, 0x02, 0x99, 0x00, 0x19, 0x00, 0x09, 0x00, 0x05, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00,
+      0x55, 0x09, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x02, 0xa9, 0x00, 0x29, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x02, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xa9, 0x02, 0xa9, 0x02, 0xa9, 0x00, 0x29, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x29, 0x00, 0x29, 0x00, 0x29, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x0a, 0xc0, 0x0a, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xff,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0xa9, 0x55, 0xa9, 0x55, 0xa9, 0x55, 0x29, 0x55, 0x09, 0x55, 0x02, 0x55, 0x00, 0x55, 0x00,
+      0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x95, 0x00,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x00, 0x25, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0xa9, 0x55, 0xa9, 0x55, 0x29, 0x55, 0x29, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x95, 0xaa, 0x95, 0x2a, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x95, 0x00, 0x05, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0xa5, 0x55, 0x25, 0x55, 0x25, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x95, 0x29, 0x95, 0x29, 0x95, 0x29, 0x95, 0x09, 0x95, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0xa5, 0x2a, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x00, 0x25, 0x00, 0x05, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x25, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x95, 0x2a, 0x95, 0x0a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x09, 0x55, 0x09, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x95, 0x0a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x00, 0xa9, 0x00, 0x29, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0xa9, 0x02, 0xa9, 0x02, 0xa9, 0x00, 0x29, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0xc0, 0x02, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0xc0, 0x0a, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc,
+      0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0x25, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01,
+      0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x15, 0x00,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0x25, 0x55, 0x09, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x95, 0x00,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x00, 0xa5, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0xa9, 0x55, 0xa9, 0x55, 0x29, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x00, 0xa5, 0x00, 0x05, 0x00,
+      0xa9, 0xaa, 0xa9, 0x2a, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x00, 0xa9, 0x00, 0x09, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x29, 0x55, 0x29, 0x55, 0x09, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0xa5, 0x2a, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x02, 0xa5, 0x00, 0x25, 0x00, 0x05, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x29, 0x55, 0x09, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x2a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00,
+      0x55, 0x0a, 0x55, 0x02, 0x55, 0x02, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x02, 0x55, 0x02, 0x55, 0x00, 0x15, 0x00, 0x25, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x8a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x00, 0x95, 0x00, 0x15, 0x00, 0x25, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x16, 0x00, 0x26, 0x00, 0x06, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x06, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0xc0, 0x02, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+      0x0a, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0x25, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00,
+      0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x02,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0xa9, 0x55, 0xa9, 0x55, 0xa9, 0x55, 0x29, 0x55, 0x09, 0x55, 0x09, 0x55, 0x00, 0x55, 0x00,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x00,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x00, 0x15, 0x00,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x00, 0xa5, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0xa5, 0x55, 0xa5, 0x55, 0x25, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0xaa, 0x55, 0x2a, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0xa5, 0x55, 0x25, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0xaa, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x25, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0xa9, 0x2a, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x00, 0xa9, 0x00, 0x09, 0x00, 0x05, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x1a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0xa9, 0x0a, 0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x02, 0xa9, 0x00, 0x29, 0x00, 0x09, 0x00, 0x01, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x06, 0x55, 0x02, 0x55, 0x02, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x02, 0x55, 0x02, 0x55, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x8a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x00, 0x95, 0x00, 0x95, 0x00, 0x25, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x95, 0x00, 0x95, 0x00, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x9a, 0x00, 0x9a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x25, 0x00, 0x25, 0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x25, 0x55, 0x05, 0x55, 0x01,
+      0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02,
+      0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x25, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x02,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x02,
+      0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0x25, 0x55, 0x25, 0x55, 0x09, 0x55, 0x01, 0x55, 0x01,
+      0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00,
+      0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x02, 0xa9, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0x25, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x00, 0x95, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0xa9, 0x55, 0xa9, 0x55, 0x29, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x00, 0xa9, 0x00, 0x29, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x65, 0x55, 0x65, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0xaa, 0x55, 0x2a, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x29, 0x55, 0x19, 0x55, 0x09, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x2a, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x19, 0x55, 0x09, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00,
+      0x95, 0x0a, 0x95, 0x02, 0x95, 0x02, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x02, 0x55, 0x02, 0x55, 0x02, 0x95, 0x00, 0x95, 0x00, 0x25, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x95, 0x02, 0x95, 0x00, 0x95, 0x00, 0x95, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x00, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x26, 0x00, 0x26, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x29, 0x00, 0x09, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x09, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x25, 0x55, 0x25, 0x55, 0x09,
+      0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0x2a, 0x95, 0x2a, 0x95, 0x0a,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x0a,
+      0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x0a,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0xa5, 0x55, 0x25, 0x55, 0x09, 0x55, 0x02,
+      0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0xaa, 0x95, 0x2a, 0x95, 0x0a, 0x95, 0x02,
+      0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0xa9, 0x55, 0xa9, 0x55, 0xa9, 0x55, 0xa9, 0x55, 0x29, 0x55, 0x09, 0x55, 0x01, 0x55, 0x00,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x2a, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x00, 0x15, 0x00,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x02, 0xa5, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x00, 0x15, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0xa5, 0x55, 0xa5, 0x55, 0x95, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0xa5, 0xaa, 0xa5, 0xaa, 0xa5, 0x2a, 0xa5, 0x0a, 0xa5, 0x02, 0xa5, 0x02, 0xa5, 0x00, 0x25, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x95, 0x55, 0x55, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0xaa, 0x55, 0xaa, 0x55, 0x1a, 0x55, 0x06, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0xa9, 0xaa, 0xa9, 0xaa, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x00, 0x29, 0x00, 0x29, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00,
+      0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00,
+      0x55, 0x25, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x2a, 0x55, 0x2a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0xa9, 0x2a, 0xa9, 0x2a, 0xa9, 0x0a, 0xa9, 0x02, 0xa9, 0x00, 0xa9, 0x00, 0x29, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00,
+      0x55, 0x55, 0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x19, 0x55, 0x15, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x0a, 0x55, 0x0a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x00, 0x95, 0x00, 0x25, 0x00, 0x01, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x15, 0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x15, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x0a, 0x55, 0x0a, 0x55, 0x02, 0x55, 0x02, 0x95, 0x00, 0x25, 0x00, 0x09, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x2a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00,
+      0x55, 0x05, 0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x95, 0x02, 0x95, 0x02, 0x95, 0x00, 0x95, 0x00, 0x25, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0x2a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00,
+      0x55, 0x05, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x05, 0x00,
+      0x95, 0x02, 0x95, 0x02, 0x95, 0x00, 0x95, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x96, 0x00, 0x96, 0x00, 0x16, 0x00, 0x26, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x0a, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x55, 0x01, 0x55, 0x01, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x95, 0x00, 0x95, 0x00, 0x15, 0x00, 0x15, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0xaa, 0x02, 0xaa, 0x02, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00,
+      0x95, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x95, 0x00, 0x25, 0x00, 0x25, 0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x55, 0x00, 0x55, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x25, 0x00, 0x25, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x25, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0xaa, 0x00, 0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x25, 0x00, 0x29, 0x00, 0x09, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x2a, 0x00, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    static_assert(NUM_BYTES == knnGridPackedBytes(layout), "grid size mismatch");
+};
+
+#endif // KNN_DECISION_GRID_DATA_H
@@ -0,0 +1,145 @@
+#ifndef KNN_ENGINE_H
+#define KNN_ENGINE_H
+
+#include <stdint.h>
+#include "KnnTrainingData.h"
+#include "KnnTopK.h"
+#include "KnnFeatureStore.h"
+#include "KnnQuantized.h"
+#include "KnnKdTree.h"
+
+// KnnEngine.h
+// Engine KNN dengan semua dimensi sebagai template parameter:
+//   N = jumlah baris training, D = jumlah feature, K = jumlah tetangga,
+//   C = jumlah kelas.
+// Loop feature/tetangga/kelas punya trip count compile-time (di-unroll),
+// buffer top-K dan array vote berukuran tetap di stack. Engine hanya view
+// atas store constexpr dari KnnModel, jadi bisa dibuat constexpr di flash.
+// N adalah ukuran model yang di-compile; view atas model dari file
+// (KnnModelFile.h) boleh punya jumlah baris lain, scan memakai store.size.
+
+// Engine yang dipakai KNNClassifier (dan knnClassifyBatch) untuk tahap KNN
+enum class KnnBackend {
+    FLOAT_SCAN = 0,     // float SoA scan (default)
+    QUANTIZED = 1,      // int16 Q6.9 + integer squared distance
+    KD_TREE = 2,        // KD-tree exact search, dibangun saat initialize()
+    DECISION_GRID = 3   // lookup grid keputusan yang di-generate offline (approximate)
+};
+
+template <typename Sensor>
+inline float knnReadChannel(const Sensor& data, KnnChannel channel) {
+    switch (channel) {
+        case KnnChannel::AFR: return data.afr;
+        case KnnChannel::RPM: return data.rpm;
+        case KnnChannel::TEMP: return data.temp;
+        case KnnChannel::TPS: return data.tps;
+        case KnnChannel::MAP: return data.map_value;
+        case KnnChannel::INCLINE: return data.incline;
+        case KnnChannel::STROKE: return data.stroke;
+    }
+    return 0.0f;
+}
+
+inline const char* knnChannelName(KnnChannel channel) {
+    switch (channel) {
+        case KnnChannel::AFR: return "AFR";
+        case KnnChannel::RPM: return "RPM";
+        case KnnChannel::TEMP: return "TEMP";
+        case KnnChannel::TPS: return "TPS";
+        case KnnChannel::MAP: return "MAP";
+        case KnnChannel::INCLINE: return "INCLINE";
+        case KnnChannel::STROKE: return "STROKE";
+    }
+    return "?";
+}
+
+template <int N, int D, int K, int C>
+class KnnEngine {
+public:
+    static constexpr int NUM_SAMPLES = N;
+    static constexpr int NUM_FEATURES = D;
+    static constexpr int K_VALUE = K;
+    static constexpr int NUM_CLASSES = C;
+
+    static_assert(N > 0 && D > 0, "Model kosong");
+    static_assert(K > 0 && K <= N, "K harus di antara 1 dan jumlah baris training");
+    static_assert(C > 0 && C <= 256, "Label disimpan sebagai uint8_t");
+
+    typedef KnnTopK<K> TopK;
+    typedef KnnTopK<K, uint32_t> QuantizedTopK;
+    typedef KnnKdTree<D> KdTree;
+
+    // channels/means/stds berisi D elemen: tabel constexpr KnnModel atau
+    // view atas buffer model file (milik caller)
+    constexpr KnnEngine(const KnnChannel* channels, const float* means, const float* stds,
+                        const KnnFeatureStore<D>& store, const KnnFeatureStore<D, int16_t>& quantizedStore)
+        : channels(channels), means(means), stds(stds), store(&store), quantizedStore(&quantizedStore),
+          extraStore(nullptr), extraQuantizedStore(nullptr) {}
+
+    // Sample tambahan (KnnOnlineSet.h) yang di-scan ke top-K yang sama setelah
+    // store utama, dengan index setelah baris terakhir store utama
+    void setExtraStores(const KnnFeatureStore<D>* extra, const KnnFeatureStore<D, int16_t>* extraQuantized) {
+        extraStore = extra;
+        extraQuantizedStore = extraQuantized;
+    }
+
+    // Vector raw dari SensorData sesuai urutan channel model
+    template <typename Sensor>
+    void extract(const Sensor& data, float (&features)[D]) const {
+        KNN_UNROLL
+        for (int f = 0; f < D; f++) features[f] = knnReadChannel(data, channels[f]);
+    }
+
+    // Z-score in-place dengan parameter training set
+    void normalize(float (&features)[D]) const {
+        KNN_UNROLL
+        for (int f = 0; f < D; f++) features[f] = (features[f] - means[f]) / stds[f];
+    }
+
+    void quantize(const float (&normalized)[D], int16_t (&quantized)[D]) const {
+        KNN_UNROLL
+        for (int f = 0; f < D; f++) quantized[f] = knnQuantize(normalized[f]);
+    }
+
+    int classifyScan(const float (&normalized)[D]) const {
+        TopK nearest;
+        knnScanColumns(normalized, *store, nearest);
+        if (extraStore) knnScanColumns(normalized, *extraStore, nearest, store->size);
+        return nearest.template vote<C>();
+    }
+
+    int classifyQuantized(const float (&normalized)[D]) const {
+        int16_t quantized[D];
+        quantize(normalized, quantized);
+        QuantizedTopK nearest;
+        knnScanQuantized(quantized, *quantizedStore, nearest);
+        if (extraQuantizedStore) knnScanQuantized(quantized, *extraQuantizedStore, nearest, store->size);
+        return nearest.template vote<C>();
+    }
+
+    int classifyKdTree(const KdTree& tree, const float (&normalized)[D]) const {
+        TopK nearest;
+        tree.search(normalized, nearest);
+        if (extraStore) knnScanColumns(normalized, *extraStore, nearest, store->size);
+        return nearest.template vote<C>();
+    }
+
+    bool buildKdTree(KdTree& tree) const { return tree.build(*store); }
+
+    KnnChannel channel(int f) const { return channels[f]; }
+    float mean(int f) const { return means[f]; }
+    float stddev(int f) const { return stds[f]; }
+    uint32_t size() const { return store->size; }
+
+private:
+    // Pointer (bukan referensi) supaya engine bisa di-assign saat model diganti
+    const KnnChannel* channels;
+    const float* means;
+    const float* stds;
+    const KnnFeatureStore<D>* store;
+    const KnnFeatureStore<D, int16_t>* quantizedStore;
+    const KnnFeatureStore<D>* extraStore;
+    const KnnFeatureStore<D, int16_t>* extraQuantizedStore;
+};
+
+#endif // KNN_ENGINE_H
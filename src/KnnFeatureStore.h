@@ -0,0 +1,81 @@
+#ifndef KNN_FEATURE_STORE_H
+#define KNN_FEATURE_STORE_H
+
+#include <stdint.h>
+#include "KnnTopK.h"
+
+// KnnFeatureStore.h
+// Training set dalam layout column-major (SoA): satu array contiguous per
+// feature dan array label terpisah. Store ini hanya view (tidak memiliki
+// data), jadi bisa menunjuk ke tabel constexpr di flash maupun buffer RAM.
+// T = float untuk engine biasa, int16_t untuk engine quantized.
+
+template <int D, typename T = float>
+struct KnnFeatureStore {
+    const T* columns[D];
+    const uint8_t* labels;
+    uint32_t size;
+};
+
+// Jumlah baris yang diproses per iterasi kernel. 8 float = 2x SSE / 1x AVX
+// di host, dan di ESP32 cukup kecil untuk tetap di register.
+static constexpr int KNN_SCAN_BLOCK = 8;
+
+// Distance kernel: setiap blok KNN_SCAN_BLOCK baris dihitung feature demi
+// feature dari kolom yang contiguous (auto-vectorizable), lalu kandidat
+// yang lolos dimasukkan ke top-K. Blok dilewati begitu semua partial sum
+// di dalamnya sudah melewati jarak K-terjauh saat ini. indexBase digeser
+// saat store kedua (mis. sample online) di-scan ke top-K yang sama.
+template <int K, int D>
+inline void knnScanColumns(const float* query, const KnnFeatureStore<D>& store, KnnTopK<K>& topK,
+                           uint32_t indexBase = 0) {
+    const uint32_t count = store.size;
+    uint32_t i = 0;
+
+    for (; i + KNN_SCAN_BLOCK <= count; i += KNN_SCAN_BLOCK) {
+        const float bound = topK.worstDistance();
+        float dist[KNN_SCAN_BLOCK] = {};
+        bool skip = false;
+
+        KNN_UNROLL
+        for (int f = 0; f < D; f++) {
+            const float* __restrict col = store.columns[f] + i;
+            const float q = query[f];
+            for (int r = 0; r < KNN_SCAN_BLOCK; r++) {
+                float diff = q - col[r];
+                dist[r] += diff * diff;
+            }
+
+            float blockMin = dist[0];
+            for (int r = 1; r < KNN_SCAN_BLOCK; r++) {
+                blockMin = dist[r] < blockMin ? dist[r] : blockMin;
+            }
+            if (blockMin > bound) {
+                skip = true;
+                break;
+            }
+        }
+        if (skip) continue;
+
+        for (int r = 0; r < KNN_SCAN_BLOCK; r++) {
+            if (topK.accepts(dist[r], indexBase + i + r)) {
+                topK.offer(dist[r], indexBase + i + r, store.labels[i + r]);
+            }
+        }
+    }
+
+    // Sisa baris (count bukan kelipatan KNN_SCAN_BLOCK)
+    for (; i < count; i++) {
+        float dist = 0;
+        KNN_UNROLL
+        for (int f = 0; f < D; f++) {
+            float diff = query[f] - store.columns[f][i];
+            dist += diff * diff;
+        }
+        if (topK.accepts(dist, indexBase + i)) {
+            topK.offer(dist, indexBase + i, store.labels[i]);
+        }
+    }
+}
+
+#endif // KNN_FEATURE_STORE_H
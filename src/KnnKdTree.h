@@ -0,0 +1,201 @@
+#ifndef KNN_KD_TREE_H
+#define KNN_KD_TREE_H
+
+#include <stdint.h>
+#include <algorithm>
+#include <new>
+#include "KnnFeatureStore.h"
+#include "KnnTopK.h"
+
+// KnnKdTree.h
+// KD-tree statis atas feature ter-normalisasi, dibangun sekali (saat startup
+// atau offline) ke array datar: node, urutan index, dan salinan titik yang
+// sudah dipermutasi sehingga setiap leaf contiguous. Query K-nearest tetap
+// exact (tie-break (distance, index) sama dengan brute force) tetapi hanya
+// mengunjungi leaf yang bisa berisi kandidat lebih dekat.
+
+template <int D>
+class KnnKdTree {
+public:
+    static constexpr uint32_t LEAF_SIZE = 8;
+
+    KnnKdTree() : nodes(nullptr), order(nullptr), points(nullptr), labels(nullptr),
+                  nodeCount(0), pointCount(0), source(nullptr) {}
+    ~KnnKdTree() { release(); }
+
+    KnnKdTree(const KnnKdTree&) = delete;
+    KnnKdTree& operator=(const KnnKdTree&) = delete;
+
+    bool build(const KnnFeatureStore<D>& store) {
+        release();
+        const uint32_t n = store.size;
+        if (n == 0) return false;
+
+        // Split di median: setiap leaf berisi minimal LEAF_SIZE / 2 titik
+        const uint32_t maxNodes = 2 * (n / (LEAF_SIZE / 2) + 1);
+        nodes = new (std::nothrow) Node[maxNodes];
+        order = new (std::nothrow) uint32_t[n];
+        points = new (std::nothrow) float[size_t(n) * D];
+        labels = new (std::nothrow) uint8_t[n];
+        if (!nodes || !order || !points || !labels) {
+            release();
+            return false;
+        }
+
+        for (uint32_t i = 0; i < n; i++) order[i] = i;
+        source = &store;
+        pointCount = n;
+        nodeCount = 0;
+        buildNode(0, n);
+
+        // Salin titik sesuai urutan leaf (row-major per titik)
+        for (uint32_t i = 0; i < n; i++) {
+            for (int f = 0; f < D; f++) {
+                points[size_t(i) * D + f] = store.columns[f][order[i]];
+            }
+            labels[i] = store.labels[order[i]];
+        }
+        source = nullptr;
+        return true;
+    }
+
+    bool isBuilt() const { return nodeCount > 0; }
+    uint32_t size() const { return pointCount; }
+    uint32_t getNodeCount() const { return nodeCount; }
+
+    size_t memoryUsage() const {
+        return nodeCount * sizeof(Node) + pointCount * (sizeof(uint32_t) + sizeof(float) * D + 1);
+    }
+
+    // Exact K-nearest. visited (opsional) = jumlah titik yang jaraknya dihitung
+    template <int K>
+    void search(const float* query, KnnTopK<K>& topK, uint32_t* visited = nullptr) const {
+        if (!isBuilt()) return;
+        float offsets[D] = {};
+        uint32_t count = 0;
+        searchNode(0, query, 0.0f, offsets, topK, count);
+        if (visited) *visited = count;
+    }
+
+private:
+    struct Node {
+        float split;
+        int32_t dim;       // -1 untuk leaf
+        uint32_t begin;    // range titik [begin, end) di order/points
+        uint32_t end;
+        uint32_t left;
+        uint32_t right;
+    };
+
+    Node* nodes;
+    uint32_t* order;
+    float* points;
+    uint8_t* labels;
+    uint32_t nodeCount;
+    uint32_t pointCount;
+    const KnnFeatureStore<D>* source;  // hanya valid selama build()
+
+    void release() {
+        delete[] nodes;
+        delete[] order;
+        delete[] points;
+        delete[] labels;
+        nodes = nullptr;
+        order = nullptr;
+        points = nullptr;
+        labels = nullptr;
+        nodeCount = 0;
+        pointCount = 0;
+    }
+
+    uint32_t buildNode(uint32_t begin, uint32_t end) {
+        const uint32_t index = nodeCount++;
+        Node& node = nodes[index];
+        node.begin = begin;
+        node.end = end;
+        node.dim = -1;
+        node.split = 0;
+        node.left = node.right = 0;
+
+        if (end - begin <= LEAF_SIZE) return index;
+
+        // Split di dimensi dengan spread terbesar, pada median
+        int bestDim = 0;
+        float bestSpread = -1;
+        for (int f = 0; f < D; f++) {
+            const float* col = source->columns[f];
+            float lo = col[order[begin]];
+            float hi = lo;
+            for (uint32_t i = begin + 1; i < end; i++) {
+                float v = col[order[i]];
+                lo = v < lo ? v : lo;
+                hi = v > hi ? v : hi;
+            }
+            if (hi - lo > bestSpread) {
+                bestSpread = hi - lo;
+                bestDim = f;
+            }
+        }
+
+        const float* col = source->columns[bestDim];
+        const uint32_t mid = begin + (end - begin) / 2;
+        std::nth_element(order + begin, order + mid, order + end,
+                         [col](uint32_t a, uint32_t b) { return col[a] < col[b]; });
+
+        const float split = col[order[mid]];
+        const uint32_t left = buildNode(begin, mid);
+        const uint32_t right = buildNode(mid, end);
+
+        // nodes[] tidak pernah realokasi, referensi node masih valid
+        node.dim = bestDim;
+        node.split = split;
+        node.left = left;
+        node.right = right;
+        return index;
+    }
+
+    // rd = jarak kuadrat minimum dari query ke sel node (incremental)
+    template <int K>
+    void searchNode(uint32_t index, const float* query, float rd, float* offsets,
+                    KnnTopK<K>& topK, uint32_t& visited) const {
+        const Node& node = nodes[index];
+
+        if (node.dim < 0) {
+            for (uint32_t i = node.begin; i < node.end; i++) {
+                const float* p = points + size_t(i) * D;
+                const float bound = topK.worstDistance();
+                float dist = 0;
+                int f = 0;
+                for (; f < D; f++) {
+                    float diff = query[f] - p[f];
+                    dist += diff * diff;
+                    if (dist > bound) break;
+                }
+                visited++;
+                if (f == D && topK.accepts(dist, order[i])) {
+                    topK.offer(dist, order[i], labels[i]);
+                }
+            }
+            return;
+        }
+
+        const int dim = node.dim;
+        const float diff = query[dim] - node.split;
+        const uint32_t nearChild = diff < 0 ? node.left : node.right;
+        const uint32_t farChild = diff < 0 ? node.right : node.left;
+
+        searchNode(nearChild, query, rd, offsets, topK, visited);
+
+        // Sel anak jauh: ganti offset dimensi ini dengan jarak ke bidang split.
+        // <= supaya titik berjarak sama dengan index lebih kecil tetap ditemukan.
+        const float oldOffset = offsets[dim];
+        const float farRd = rd - oldOffset * oldOffset + diff * diff;
+        if (farRd <= topK.worstDistance()) {
+            offsets[dim] = diff;
+            searchNode(farChild, query, farRd, offsets, topK, visited);
+            offsets[dim] = oldOffset;
+        }
+    }
+};
+
+#endif // KNN_KD_TREE_H
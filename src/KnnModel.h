@@ -0,0 +1,124 @@
+#ifndef KNN_MODEL_H
+#define KNN_MODEL_H
+
+#include <stdint.h>
+#include "KnnTrainingData.h"
+#include "KnnFeatureStore.h"
+#include "KnnQuantized.h"
+#include "KnnEngine.h"
+
+// KnnModel.h
+// Z-scored training matrix yang dihitung saat compile. Runtime cukup
+// menormalisasi satu query vector per klasifikasi.
+//
+// Build dengan -DKNN_USE_CONDENSED_SET untuk memakai prototype subset dari
+// tools/knn_condense.cpp (KnnCondensedData.h) sebagai pengganti 200 baris
+// penuh. Normalisasi tetap memakai mean/std dari training set penuh.
+
+#ifdef KNN_USE_CONDENSED_SET
+#include "KnnCondensedData.h"
+typedef KnnCondensedData KnnPrototypeData;
+#else
+typedef KnnTrainingData KnnPrototypeData;
+#endif
+
+// Column-major: columns[f] adalah semua nilai feature f secara berurutan
+template <int D, int N>
+struct KnnNormalizedSet {
+    float columns[D][N];
+    uint8_t labels[N];
+};
+
+// Row = tipe sample dataset, harus punya feature(f) dan classification
+template <int D, int N, typename Row>
+constexpr KnnNormalizedSet<D, N> knnNormalizeSet(const Row (&raw)[N], const float (&means)[D],
+                                                 const float (&stds)[D]) {
+    KnnNormalizedSet<D, N> set{};
+    for (int i = 0; i < N; i++) {
+        for (int f = 0; f < D; f++) {
+            set.columns[f][i] = (raw[i].feature(f) - means[f]) / stds[f];
+        }
+        set.labels[i] = static_cast<uint8_t>(raw[i].classification);
+    }
+    return set;
+}
+
+// Jumlah baris per kelas (untuk laporan saat startup)
+template <int NUM_CLASSES>
+struct KnnClassCounts {
+    uint16_t counts[NUM_CLASSES];
+};
+
+template <int NUM_CLASSES, int N, typename Row>
+constexpr KnnClassCounts<NUM_CLASSES> knnCountClasses(const Row (&raw)[N]) {
+    KnnClassCounts<NUM_CLASSES> result{};
+    for (int i = 0; i < N; i++) {
+        if (raw[i].classification >= 0 && raw[i].classification < NUM_CLASSES) {
+            result.counts[raw[i].classification]++;
+        }
+    }
+    return result;
+}
+
+template <int D, int N>
+constexpr KnnFeatureStore<D> knnMakeStore(const KnnNormalizedSet<D, N>& set) {
+    KnnFeatureStore<D> store{};
+    for (int f = 0; f < D; f++) {
+        store.columns[f] = set.columns[f];
+    }
+    store.labels = set.labels;
+    store.size = N;
+    return store;
+}
+
+// Data = baris yang dipakai model (penuh atau condensed), Schema = dataset
+// penuh pemilik urutan channel dan parameter normalisasi
+template <typename Data, typename Schema>
+struct KnnModelFor {
+    static constexpr int NUM_FEATURES = Schema::NUM_FEATURES;
+    static constexpr int NUM_SAMPLES = Data::NUM_SAMPLES;
+    static constexpr int NUM_CLASSES = Schema::NUM_CLASSES;
+
+    // constexpr -> masuk .rodata (flash di ESP32), bukan RAM
+    static constexpr KnnNormalizedSet<NUM_FEATURES, NUM_SAMPLES> trainingSet =
+        knnNormalizeSet(Data::samples, Schema::featureMeans, Schema::featureStds);
+
+    static constexpr KnnClassCounts<NUM_CLASSES> classCounts =
+        knnCountClasses<NUM_CLASSES>(Data::samples);
+
+    static constexpr bool isCondensed() { return NUM_SAMPLES != Schema::NUM_SAMPLES; }
+
+    // View SoA atas trainingSet yang dipakai oleh distance kernel
+    static constexpr KnnFeatureStore<NUM_FEATURES> trainingStore = knnMakeStore(trainingSet);
+
+    // Versi int16 Q6.9 untuk engine quantized (setengah ukuran versi float)
+    static constexpr KnnQuantizedSet<NUM_FEATURES, NUM_SAMPLES> quantizedSet =
+        knnQuantizeSet(trainingSet.columns, trainingSet.labels);
+    static constexpr KnnFeatureStore<NUM_FEATURES, int16_t> quantizedStore = knnMakeQuantizedStore(quantizedSet);
+
+    // Engine dengan K dan jumlah kelas pilihan caller, di atas store model ini
+    template <int K, int C = NUM_CLASSES>
+    static constexpr KnnEngine<NUM_SAMPLES, NUM_FEATURES, K, C> makeEngine() {
+        return KnnEngine<NUM_SAMPLES, NUM_FEATURES, K, C>(Schema::channels, Schema::featureMeans,
+                                                           Schema::featureStds, trainingStore, quantizedStore);
+    }
+
+    // Normalisasi query vector pakai parameter yang sama dengan training set
+    static void normalizeQuery(float* features) {
+        KNN_UNROLL
+        for (int i = 0; i < NUM_FEATURES; i++) {
+            features[i] = (features[i] - Schema::featureMeans[i]) / Schema::featureStds[i];
+        }
+    }
+
+    static void quantizeQuery(const float* normalized, int16_t* quantized) {
+        KNN_UNROLL
+        for (int i = 0; i < NUM_FEATURES; i++) {
+            quantized[i] = knnQuantize(normalized[i]);
+        }
+    }
+};
+
+typedef KnnModelFor<KnnPrototypeData, KnnTrainingData> KnnModel;
+
+#endif // KNN_MODEL_H
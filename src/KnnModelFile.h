@@ -0,0 +1,161 @@
+#ifndef KNN_MODEL_FILE_H
+#define KNN_MODEL_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "KnnTrainingData.h"
+#include "KnnFeatureStore.h"
+
+// KnnModelFile.h
+// Format biner model KNN (mis. /knn_model.bin di SPIFFS) supaya model bisa
+// diganti tanpa reflash firmware. File dibaca utuh ke satu buffer lalu
+// di-bind sebagai view: tidak ada parsing per baris, store menunjuk langsung
+// ke kolom di dalam buffer. Dibuat di host oleh tools/knn_model_pack.cpp.
+//
+// Layout (little-endian, sama dengan ESP32 dan host x86/ARM):
+//   KnnModelFileHeader                        (36 byte)
+//   float   means[D]                          parameter z-score
+//   float   stds[D]
+//   float   columns[D][N]                     z-scored, column-major
+//   int16_t quantized[D][N]                   Q6.9 (KnnQuantized.h)
+//   uint8_t labels[N]
+// payloadCrc = CRC-32 (IEEE) atas seluruh payload setelah header.
+
+static constexpr uint32_t KNN_MODEL_FILE_MAGIC = 0x4D4E4E4B;  // "KNNM"
+static constexpr uint16_t KNN_MODEL_FILE_VERSION = 1;
+static constexpr int KNN_MODEL_FILE_MAX_FEATURES = 8;
+
+struct KnnModelFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;
+    uint16_t numFeatures;
+    uint16_t numClasses;
+    uint16_t kValue;
+    uint16_t reserved;
+    uint32_t numSamples;
+    uint32_t payloadSize;
+    uint32_t payloadCrc;
+    uint8_t channels[KNN_MODEL_FILE_MAX_FEATURES];  // KnnChannel per kolom
+};
+
+static_assert(sizeof(KnnModelFileHeader) == 36, "Layout header model file berubah");
+static_assert(sizeof(KnnModelFileHeader) % 4 == 0, "Payload float harus 4-byte aligned");
+
+// 64-bit supaya numSamples dari file yang rusak tidak bisa overflow
+inline uint64_t knnModelFilePayloadSize(uint32_t numFeatures, uint32_t numSamples) {
+    return uint64_t(numFeatures) * 2 * sizeof(float) +
+           uint64_t(numFeatures) * numSamples * (sizeof(float) + sizeof(int16_t)) + uint64_t(numSamples);
+}
+
+// CRC-32 IEEE 802.3 (reflected, poly 0xEDB88320), tanpa tabel: hanya
+// dipanggil sekali saat load, beberapa KB
+inline uint32_t knnCrc32(const uint8_t* data, size_t size, uint32_t crc = 0) {
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+// View atas image file yang sudah divalidasi. Pointer menunjuk ke buffer
+// pemanggil, jadi buffer harus hidup selama view dipakai.
+template <int D>
+struct KnnModelFileView {
+    KnnChannel channels[D];
+    const float* means;
+    const float* stds;
+    KnnFeatureStore<D> store;
+    KnnFeatureStore<D, int16_t> quantizedStore;
+    uint16_t kValue;
+    uint16_t numClasses;
+};
+
+enum class KnnModelFileStatus {
+    OK,
+    TOO_SMALL,
+    BAD_MAGIC,
+    BAD_VERSION,
+    SHAPE_MISMATCH,   // feature/kelas/K tidak sama dengan engine yang di-compile
+    BAD_SIZE,
+    BAD_CRC,
+    BAD_CONTENT       // channel, std atau label di luar range
+};
+
+inline const char* knnModelFileStatusText(KnnModelFileStatus status) {
+    switch (status) {
+        case KnnModelFileStatus::OK: return "OK";
+        case KnnModelFileStatus::TOO_SMALL: return "file lebih kecil dari header";
+        case KnnModelFileStatus::BAD_MAGIC: return "bukan file model KNN";
+        case KnnModelFileStatus::BAD_VERSION: return "versi format tidak didukung";
+        case KnnModelFileStatus::SHAPE_MISMATCH: return "feature/kelas/K tidak cocok dengan firmware";
+        case KnnModelFileStatus::BAD_SIZE: return "ukuran payload salah";
+        case KnnModelFileStatus::BAD_CRC: return "checksum salah";
+        case KnnModelFileStatus::BAD_CONTENT: return "isi model tidak valid";
+    }
+    return "?";
+}
+
+// Validasi image dan isi view. image harus 4-byte aligned (buffer new[]/malloc).
+// K dan C = nilai yang di-compile ke engine; file dengan nilai lain ditolak.
+template <int D>
+KnnModelFileStatus knnBindModelFile(const uint8_t* image, size_t size, int kValue, int numClasses,
+                                    KnnModelFileView<D>& view) {
+    static_assert(D <= KNN_MODEL_FILE_MAX_FEATURES, "Terlalu banyak feature untuk header model file");
+
+    if (size < sizeof(KnnModelFileHeader)) return KnnModelFileStatus::TOO_SMALL;
+    KnnModelFileHeader header;
+    memcpy(&header, image, sizeof(header));
+
+    if (header.magic != KNN_MODEL_FILE_MAGIC) return KnnModelFileStatus::BAD_MAGIC;
+    if (header.version != KNN_MODEL_FILE_VERSION || header.headerSize != sizeof(KnnModelFileHeader)) {
+        return KnnModelFileStatus::BAD_VERSION;
+    }
+    if (header.numFeatures != D || header.numClasses != numClasses || header.kValue != kValue ||
+        header.numSamples < uint32_t(kValue)) {
+        return KnnModelFileStatus::SHAPE_MISMATCH;
+    }
+    const uint32_t n = header.numSamples;
+    if (header.payloadSize != knnModelFilePayloadSize(D, n) ||
+        uint64_t(size) != sizeof(KnnModelFileHeader) + uint64_t(header.payloadSize)) {
+        return KnnModelFileStatus::BAD_SIZE;
+    }
+
+    const uint8_t* payload = image + sizeof(KnnModelFileHeader);
+    if (knnCrc32(payload, header.payloadSize) != header.payloadCrc) return KnnModelFileStatus::BAD_CRC;
+
+    const float* means = reinterpret_cast<const float*>(payload);
+    const float* stds = means + D;
+    const float* columns = stds + D;
+    const int16_t* quantized = reinterpret_cast<const int16_t*>(columns + size_t(D) * n);
+    const uint8_t* labels = reinterpret_cast<const uint8_t*>(quantized + size_t(D) * n);
+
+    for (int f = 0; f < D; f++) {
+        if (header.channels[f] > uint8_t(KnnChannel::STROKE)) return KnnModelFileStatus::BAD_CONTENT;
+        if (!(stds[f] > 0.0f)) return KnnModelFileStatus::BAD_CONTENT;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        if (labels[i] >= numClasses) return KnnModelFileStatus::BAD_CONTENT;
+    }
+
+    for (int f = 0; f < D; f++) {
+        view.channels[f] = KnnChannel(header.channels[f]);
+        view.store.columns[f] = columns + size_t(f) * n;
+        view.quantizedStore.columns[f] = quantized + size_t(f) * n;
+    }
+    view.means = means;
+    view.stds = stds;
+    view.store.labels = labels;
+    view.store.size = n;
+    view.quantizedStore.labels = labels;
+    view.quantizedStore.size = n;
+    view.kValue = header.kValue;
+    view.numClasses = header.numClasses;
+    return KnnModelFileStatus::OK;
+}
+
+#endif // KNN_MODEL_FILE_H
@@ -0,0 +1,206 @@
+#ifndef KNN_ONLINE_SET_H
+#define KNN_ONLINE_SET_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "KnnTrainingData.h"
+#include "KnnFeatureStore.h"
+#include "KnnQuantized.h"
+#include "KnnModelFile.h"
+
+// KnnOnlineSet.h
+// Buffer sample berlabel yang ditangkap di lintasan (serial AI_LEARN atau
+// tombol), kapasitas tetap dan tanpa heap. Sample disimpan di slot tetap
+// dalam layout column-major yang sama dengan training set, jadi engine
+// cukup men-scan store ini setelah store utama (KnnEngine::setExtraStores).
+// Menambah sample hanya menulis satu slot: tidak ada rebuild index.
+//
+// Snapshot raw semua channel ikut disimpan, sehingga sample bisa
+// dinormalisasi ulang saat model (mean/std/urutan channel) diganti dan
+// di-persist ke flash tanpa bergantung pada model yang aktif.
+
+enum class KnnEvictionPolicy {
+    OLDEST = 0,          // slot tertua ditimpa (ring)
+    CLASS_BALANCED = 1   // sample tertua dari kelas dengan sample terbanyak ditimpa
+};
+
+static constexpr uint32_t KNN_ONLINE_FILE_MAGIC = 0x4F4E4E4B;  // "KNNO"
+static constexpr uint16_t KNN_ONLINE_FILE_VERSION = 1;
+
+struct KnnOnlineSample {
+    float raw[KNN_CHANNEL_COUNT];  // index = KnnChannel
+    uint32_t sequence;             // urutan capture, untuk eviction oldest-first
+    uint8_t label;
+    uint8_t reserved[3];
+};
+
+struct KnnOnlineFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t sampleSize;  // sizeof(KnnOnlineSample)
+    uint32_t count;
+    uint32_t nextSequence;
+    uint32_t crc;         // CRC-32 atas sample[0..count)
+};
+
+template <int D, int CAPACITY, int C>
+class KnnOnlineSet {
+public:
+    static_assert(CAPACITY > 0 && CAPACITY <= 0xFFFF, "Kapasitas online set tidak valid");
+    static constexpr int SAMPLE_BYTES = sizeof(KnnOnlineSample);
+    static constexpr size_t MAX_FILE_BYTES = sizeof(KnnOnlineFileHeader) + sizeof(KnnOnlineSample) * CAPACITY;
+
+    KnnOnlineSet() { clear(); }
+
+    // Store menunjuk ke array milik objek ini
+    KnnOnlineSet(const KnnOnlineSet&) = delete;
+    KnnOnlineSet& operator=(const KnnOnlineSet&) = delete;
+
+    void clear() {
+        count = 0;
+        nextSequence = 1;
+        for (int c = 0; c < C; c++) classCounts[c] = 0;
+        for (int f = 0; f < D; f++) {
+            floatStore.columns[f] = columns[f];
+            quantizedStore.columns[f] = quantizedColumns[f];
+        }
+        floatStore.labels = labels;
+        quantizedStore.labels = labels;
+        floatStore.size = 0;
+        quantizedStore.size = 0;
+    }
+
+    // Tambah satu sample; Engine dipakai untuk urutan channel dan mean/std.
+    // Mengembalikan slot yang ditulis, atau -1 jika label di luar range.
+    template <typename Engine>
+    int add(const float (&raw)[KNN_CHANNEL_COUNT], int label, KnnEvictionPolicy policy, const Engine& engine) {
+        if (label < 0 || label >= C) return -1;
+
+        int slot;
+        if (count < uint32_t(CAPACITY)) {
+            slot = int(count++);
+        } else {
+            slot = evictionSlot(policy);
+            classCounts[samples[slot].label]--;
+        }
+
+        KnnOnlineSample& sample = samples[slot];
+        memcpy(sample.raw, raw, sizeof(sample.raw));
+        sample.sequence = nextSequence++;
+        sample.label = uint8_t(label);
+        memset(sample.reserved, 0, sizeof(sample.reserved));
+        classCounts[label]++;
+
+        normalizeSlot(slot, engine);
+        publishSize();
+        return slot;
+    }
+
+    // Normalisasi ulang semua slot untuk model yang baru diaktifkan
+    template <typename Engine>
+    void renormalize(const Engine& engine) {
+        for (uint32_t i = 0; i < count; i++) normalizeSlot(int(i), engine);
+    }
+
+    uint32_t size() const { return count; }
+    uint32_t capacity() const { return CAPACITY; }
+    uint32_t getClassCount(int c) const { return c >= 0 && c < C ? classCounts[c] : 0; }
+    const KnnOnlineSample& sample(uint32_t slot) const { return samples[slot]; }
+
+    const KnnFeatureStore<D>* store() const { return &floatStore; }
+    const KnnFeatureStore<D, int16_t>* quantized() const { return &quantizedStore; }
+
+    // Serialisasi: header + sample[0..count). buffer minimal MAX_FILE_BYTES.
+    size_t serialize(uint8_t* buffer) const {
+        KnnOnlineFileHeader header;
+        header.magic = KNN_ONLINE_FILE_MAGIC;
+        header.version = KNN_ONLINE_FILE_VERSION;
+        header.sampleSize = SAMPLE_BYTES;
+        header.count = count;
+        header.nextSequence = nextSequence;
+        header.crc = knnCrc32(reinterpret_cast<const uint8_t*>(samples), count * sizeof(KnnOnlineSample));
+        memcpy(buffer, &header, sizeof(header));
+        memcpy(buffer + sizeof(header), samples, count * sizeof(KnnOnlineSample));
+        return sizeof(header) + count * sizeof(KnnOnlineSample);
+    }
+
+    // False (dan set tidak berubah) jika data rusak atau tidak cocok
+    template <typename Engine>
+    bool deserialize(const uint8_t* buffer, size_t size, const Engine& engine) {
+        KnnOnlineFileHeader header;
+        if (size < sizeof(header)) return false;
+        memcpy(&header, buffer, sizeof(header));
+        if (header.magic != KNN_ONLINE_FILE_MAGIC || header.version != KNN_ONLINE_FILE_VERSION ||
+            header.sampleSize != SAMPLE_BYTES || header.count > uint32_t(CAPACITY) ||
+            size != sizeof(header) + header.count * sizeof(KnnOnlineSample)) {
+            return false;
+        }
+        const uint8_t* payload = buffer + sizeof(header);
+        if (knnCrc32(payload, header.count * sizeof(KnnOnlineSample)) != header.crc) return false;
+        for (uint32_t i = 0; i < header.count; i++) {
+            if (payload[i * sizeof(KnnOnlineSample) + offsetof(KnnOnlineSample, label)] >= C) return false;
+        }
+
+        clear();
+        memcpy(samples, payload, header.count * sizeof(KnnOnlineSample));
+        count = header.count;
+        nextSequence = header.nextSequence;
+        for (uint32_t i = 0; i < count; i++) {
+            classCounts[samples[i].label]++;
+            if (samples[i].sequence >= nextSequence) nextSequence = samples[i].sequence + 1;
+        }
+        renormalize(engine);
+        publishSize();
+        return true;
+    }
+
+private:
+    KnnOnlineSample samples[CAPACITY];
+    float columns[D][CAPACITY];
+    int16_t quantizedColumns[D][CAPACITY];
+    uint8_t labels[CAPACITY];
+    uint32_t classCounts[C];
+    uint32_t count;
+    uint32_t nextSequence;
+    KnnFeatureStore<D> floatStore;
+    KnnFeatureStore<D, int16_t> quantizedStore;
+
+    int evictionSlot(KnnEvictionPolicy policy) const {
+        int victimClass = -1;
+        if (policy == KnnEvictionPolicy::CLASS_BALANCED) {
+            uint32_t most = 0;
+            for (int c = 0; c < C; c++) {
+                if (classCounts[c] > most) {
+                    most = classCounts[c];
+                    victimClass = c;
+                }
+            }
+        }
+
+        int slot = -1;
+        for (int i = 0; i < CAPACITY; i++) {
+            if (victimClass >= 0 && samples[i].label != victimClass) continue;
+            if (slot < 0 || samples[i].sequence < samples[slot].sequence) slot = i;
+        }
+        return slot;
+    }
+
+    template <typename Engine>
+    void normalizeSlot(int slot, const Engine& engine) {
+        const KnnOnlineSample& sample = samples[slot];
+        for (int f = 0; f < D; f++) {
+            const float z = (sample.raw[int(engine.channel(f))] - engine.mean(f)) / engine.stddev(f);
+            columns[f][slot] = z;
+            quantizedColumns[f][slot] = knnQuantize(z);
+        }
+        labels[slot] = sample.label;
+    }
+
+    void publishSize() {
+        floatStore.size = count;
+        quantizedStore.size = count;
+    }
+};
+
+#endif // KNN_ONLINE_SET_H
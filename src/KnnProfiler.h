@@ -0,0 +1,95 @@
+#ifndef KNN_PROFILER_H
+#define KNN_PROFILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#else
+#include <chrono>
+#endif
+
+// KnnProfiler.h
+// Harness benchmark latency klasifikasi: N panggilan atas input sintetis
+// yang tetap (deterministik), setiap panggilan diukur sendiri lalu
+// dilaporkan min/median/p99/max dalam mikrodetik. Dipakai serial BENCH_AI
+// di firmware dan tools/knn_profile.cpp di host, dengan input yang sama,
+// jadi angka kedua sisi bisa dibandingkan per backend.
+//
+// Timer: esp_timer (resolusi 1 us) di ESP32, steady_clock (ns) di host.
+
+static constexpr int KNN_BENCH_INPUTS = 64;
+
+struct KnnBenchStats {
+    uint32_t runs;
+    float minMicros;
+    float medianMicros;
+    float p99Micros;
+    float maxMicros;
+    float meanMicros;
+};
+
+// Waktu monotonic dalam nanodetik
+inline int64_t knnProfileNanos() {
+#if defined(ESP_PLATFORM)
+    return esp_timer_get_time() * 1000;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Input sintetis: LCG dengan seed tetap di range sensor yang realistis.
+// Sebagian kecil kena rules hybrid (TPS ~0, AFR 11-12), sisanya ke KNN.
+template <typename Sensor>
+void knnBenchInputs(Sensor (&inputs)[KNN_BENCH_INPUTS]) {
+    uint32_t state = 0x5EED1234u;
+    auto next = [&state](float lo, float hi) {
+        state = state * 1664525u + 1013904223u;
+        return lo + (state >> 8) / 16777216.0f * (hi - lo);
+    };
+    for (int i = 0; i < KNN_BENCH_INPUTS; i++) {
+        Sensor& s = inputs[i];
+        s.afr = next(10.5f, 17.5f);
+        s.rpm = next(800.0f, 12000.0f);
+        s.temp = next(40.0f, 110.0f);
+        s.tps = next(0.0f, 100.0f);
+        s.map_value = next(20.0f, 110.0f);
+        s.speed = next(0.0f, 120.0f);
+        s.incline = next(-10.0f, 10.0f);
+        s.stroke = next(0.0f, 120.0f);
+    }
+}
+
+// samples: buffer minimal runs elemen, isinya terurut setelah return.
+// classify(const Sensor&) -> int; hasilnya dikumpulkan supaya tidak dibuang optimizer.
+template <typename Sensor, typename Classify>
+KnnBenchStats knnBenchmark(const Sensor* inputs, int numInputs, uint32_t runs, float* samples, Classify&& classify) {
+    KnnBenchStats stats = {};
+    if (runs == 0 || numInputs <= 0) return stats;
+
+    volatile int sink = 0;
+    double total = 0;
+    for (uint32_t r = 0; r < runs; r++) {
+        const Sensor& input = inputs[r % uint32_t(numInputs)];
+        const int64_t start = knnProfileNanos();
+        sink = sink + classify(input);
+        const int64_t end = knnProfileNanos();
+        samples[r] = float(end - start) / 1000.0f;
+        total += samples[r];
+    }
+    (void)sink;
+
+    std::sort(samples, samples + runs);
+    stats.runs = runs;
+    stats.minMicros = samples[0];
+    stats.medianMicros = samples[runs / 2];
+    stats.p99Micros = samples[(uint64_t(runs) * 99 + 99) / 100 - 1];  // nearest-rank
+    stats.maxMicros = samples[runs - 1];
+    stats.meanMicros = float(total / runs);
+    return stats;
+}
+
+#endif // KNN_PROFILER_H
@@ -0,0 +1,119 @@
+#ifndef KNN_QUANTIZED_H
+#define KNN_QUANTIZED_H
+
+#include <stdint.h>
+#include "KnnFeatureStore.h"
+#include "KnnTopK.h"
+
+// KnnQuantized.h
+// Engine KNN fixed-point: feature ter-normalisasi disimpan sebagai int16
+// Q6.9 (1/512 std per LSB) dan jarak dihitung dengan integer squared
+// distance di akumulator 32-bit. Tidak ada float divide/sqrt di loop scan.
+
+static constexpr int KNN_Q_FRAC_BITS = 9;
+static constexpr float KNN_Q_SCALE = float(1 << KNN_Q_FRAC_BITS);
+
+// z-score di-clamp ke +-16 std. Data training dan range sensor fisik ada di
+// dalam +-6 std, jadi clamp hanya menjaga akumulator dari overflow.
+static constexpr int32_t KNN_Q_LIMIT = 16 << KNN_Q_FRAC_BITS;
+
+constexpr int16_t knnQuantize(float z) {
+    float scaled = z * KNN_Q_SCALE;
+    if (scaled > float(KNN_Q_LIMIT)) scaled = float(KNN_Q_LIMIT);
+    if (scaled < -float(KNN_Q_LIMIT)) scaled = -float(KNN_Q_LIMIT);
+    return static_cast<int16_t>(scaled >= 0 ? scaled + 0.5f : scaled - 0.5f);
+}
+
+constexpr float knnDequantize(int16_t q) {
+    return float(q) / KNN_Q_SCALE;
+}
+
+template <int D, int N>
+struct KnnQuantizedSet {
+    int16_t columns[D][N];
+    uint8_t labels[N];
+};
+
+template <int D, int N>
+constexpr KnnQuantizedSet<D, N> knnQuantizeSet(const float (&columns)[D][N], const uint8_t (&labels)[N]) {
+    KnnQuantizedSet<D, N> set{};
+    for (int f = 0; f < D; f++) {
+        for (int i = 0; i < N; i++) {
+            set.columns[f][i] = knnQuantize(columns[f][i]);
+        }
+    }
+    for (int i = 0; i < N; i++) {
+        set.labels[i] = labels[i];
+    }
+    return set;
+}
+
+template <int D, int N>
+constexpr KnnFeatureStore<D, int16_t> knnMakeQuantizedStore(const KnnQuantizedSet<D, N>& set) {
+    KnnFeatureStore<D, int16_t> store{};
+    for (int f = 0; f < D; f++) {
+        store.columns[f] = set.columns[f];
+    }
+    store.labels = set.labels;
+    store.size = N;
+    return store;
+}
+
+// Integer versi dari knnScanColumns: blok KNN_SCAN_BLOCK baris, early exit
+// per blok, akumulasi uint32.
+template <int K, int D>
+inline void knnScanQuantized(const int16_t* query, const KnnFeatureStore<D, int16_t>& store,
+                             KnnTopK<K, uint32_t>& topK, uint32_t indexBase = 0) {
+    // Selisih maksimum per feature 2 * KNN_Q_LIMIT, kuadratnya 2^28:
+    // uint32 cukup sampai 15 feature
+    static_assert(uint64_t(D) * uint64_t(2 * KNN_Q_LIMIT) * uint64_t(2 * KNN_Q_LIMIT) <= 0xFFFFFFFFull,
+                  "Squared distance akan overflow akumulator 32-bit");
+    const uint32_t count = store.size;
+    uint32_t i = 0;
+
+    for (; i + KNN_SCAN_BLOCK <= count; i += KNN_SCAN_BLOCK) {
+        const uint32_t bound = topK.worstDistance();
+        uint32_t dist[KNN_SCAN_BLOCK] = {};
+        bool skip = false;
+
+        KNN_UNROLL
+        for (int f = 0; f < D; f++) {
+            const int16_t* __restrict col = store.columns[f] + i;
+            const int32_t q = query[f];
+            for (int r = 0; r < KNN_SCAN_BLOCK; r++) {
+                int32_t diff = q - col[r];
+                dist[r] += uint32_t(diff * diff);
+            }
+
+            uint32_t blockMin = dist[0];
+            for (int r = 1; r < KNN_SCAN_BLOCK; r++) {
+                blockMin = dist[r] < blockMin ? dist[r] : blockMin;
+            }
+            if (blockMin > bound) {
+                skip = true;
+                break;
+            }
+        }
+        if (skip) continue;
+
+        for (int r = 0; r < KNN_SCAN_BLOCK; r++) {
+            if (topK.accepts(dist[r], indexBase + i + r)) {
+                topK.offer(dist[r], indexBase + i + r, store.labels[i + r]);
+            }
+        }
+    }
+
+    for (; i < count; i++) {
+        uint32_t dist = 0;
+        KNN_UNROLL
+        for (int f = 0; f < D; f++) {
+            int32_t diff = int32_t(query[f]) - store.columns[f][i];
+            dist += uint32_t(diff * diff);
+        }
+        if (topK.accepts(dist, indexBase + i)) {
+            topK.offer(dist, indexBase + i, store.labels[i]);
+        }
+    }
+}
+
+#endif // KNN_QUANTIZED_H
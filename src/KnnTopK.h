@@ -0,0 +1,138 @@
+#ifndef KNN_TOP_K_H
+#define KNN_TOP_K_H
+
+#include <stdint.h>
+#include <limits>
+
+// KnnTopK.h
+// Streaming top-K: hanya K kandidat terdekat yang disimpan, dalam max-heap
+// berukuran tetap. Jarak yang dipakai adalah squared distance (tanpa sqrt),
+// float untuk engine biasa atau integer untuk engine quantized.
+// Urutan kandidat adalah (distance, index) sehingga hasil tie-break sama
+// dengan selection sort lama (index lebih kecil menang) apa pun urutan scan.
+
+// Paksa unroll loop dengan trip count compile-time (D feature, K tetangga,
+// C kelas) juga saat build -Os seperti default ESP32 Arduino
+#if defined(__GNUC__)
+#define KNN_UNROLL _Pragma("GCC unroll 16")
+#else
+#define KNN_UNROLL
+#endif
+
+template <int K, typename Distance = float>
+class KnnTopK {
+public:
+    struct Neighbor {
+        Distance distance;   // squared distance
+        uint32_t index;   // index baris training
+        uint8_t label;
+    };
+
+    KnnTopK() : count(0) {}
+
+    void reset() { count = 0; }
+    bool isFull() const { return count == K; }
+    int size() const { return count; }
+    const Neighbor& operator[](int i) const { return heap[i]; }
+
+    // Batas untuk partial-distance early exit. Selama heap belum penuh
+    // semua kandidat diterima.
+    Distance worstDistance() const {
+        return count < K ? unbounded() : heap[0].distance;
+    }
+
+    // True jika kandidat (distance, index) masuk ke K terdekat saat ini
+    bool accepts(Distance distance, uint32_t index) const {
+        if (count < K) return true;
+        return isCloser(distance, index, heap[0]);
+    }
+
+    void offer(Distance distance, uint32_t index, uint8_t label) {
+        if (count < K) {
+            int i = count++;
+            heap[i] = {distance, index, label};
+            siftUp(i);
+        } else if (isCloser(distance, index, heap[0])) {
+            heap[0] = {distance, index, label};
+            siftDown(0);
+        }
+    }
+
+    // Tetangga paling dekat (untuk tie-break voting)
+    const Neighbor& nearest() const {
+        int best = 0;
+        for (int i = 1; i < count; i++) {
+            if (isCloser(heap[i].distance, heap[i].index, heap[best])) best = i;
+        }
+        return heap[best];
+    }
+
+    // Majority vote; jika semua kelas hanya dapat satu vote, pakai tetangga
+    // terdekat (perilaku yang sama dengan implementasi lama)
+    template <int NUM_CLASSES>
+    int vote() const {
+        int votes[NUM_CLASSES] = {};
+        KNN_UNROLL
+        for (int i = 0; i < K; i++) {
+            if (i < count && heap[i].label < NUM_CLASSES) votes[heap[i].label]++;
+        }
+
+        int maxVotes = 0;
+        int result = 0;
+        KNN_UNROLL
+        for (int c = 0; c < NUM_CLASSES; c++) {
+            if (votes[c] > maxVotes) {
+                maxVotes = votes[c];
+                result = c;
+            }
+        }
+
+        if (maxVotes == 1) {
+            result = nearest().label;
+        }
+        return result;
+    }
+
+private:
+    Neighbor heap[K];
+    int count;
+
+    static constexpr Distance unbounded() {
+        return std::numeric_limits<Distance>::has_infinity ? std::numeric_limits<Distance>::infinity()
+                                                           : std::numeric_limits<Distance>::max();
+    }
+
+    static bool isCloser(Distance distance, uint32_t index, const Neighbor& other) {
+        return distance < other.distance || (distance == other.distance && index < other.index);
+    }
+
+    void siftUp(int i) {
+        while (i > 0) {
+            int parent = (i - 1) / 2;
+            if (!isCloser(heap[parent].distance, heap[parent].index, heap[i])) break;
+            swap(i, parent);
+            i = parent;
+        }
+    }
+
+    void siftDown(int i) {
+        for (;;) {
+            int largest = i;
+            int left = 2 * i + 1;
+            int right = left + 1;
+            if (left < count && isCloser(heap[largest].distance, heap[largest].index, heap[left])) largest = left;
+            if (right < count && isCloser(heap[largest].distance, heap[largest].index, heap[right])) largest = right;
+            if (largest == i) break;
+            swap(i, largest);
+            i = largest;
+        }
+    }
+
+    void swap(int a, int b) {
+        Neighbor tmp = heap[a];
+        heap[a] = heap[b];
+        heap[b] = tmp;
+    }
+};
+
+#endif // KNN_TOP_K_H
@@ -0,0 +1,61 @@
+#ifndef PULSE_TIMESTAMP_RING_H
+#define PULSE_TIMESTAMP_RING_H
+
+#include <stdint.h>
+#include <atomic>
+
+// PulseTimestampRing.h
+// Ring timestamp edge pulse (mis. sensor RPM) tanpa lock: ISR hanya menulis
+// satu slot dan menaikkan head, reader menyalin beberapa edge terbaru kapan
+// saja dan mengulang jika ISR sempat menimpa slot yang sedang disalin.
+// Timestamp uint32 (micros) boleh wrap; selisih dihitung modulo 2^32.
+// N harus pangkat dua; reader sebaiknya mengambil jauh lebih sedikit dari N.
+
+template <int N>
+class PulseTimestampRing {
+public:
+    static_assert(N >= 4 && (N & (N - 1)) == 0, "N harus pangkat dua >= 4");
+    static constexpr int MAX_READ_ATTEMPTS = 4;
+
+    PulseTimestampRing() : head(0) {
+        for (int i = 0; i < N; i++) edges[i].store(0, std::memory_order_relaxed);
+    }
+
+    PulseTimestampRing(const PulseTimestampRing&) = delete;
+    PulseTimestampRing& operator=(const PulseTimestampRing&) = delete;
+
+    // Dipanggil dari ISR (satu writer): satu store + satu increment
+    inline __attribute__((always_inline)) void record(uint32_t timestamp) {
+        const uint32_t h = head.load(std::memory_order_relaxed);
+        edges[h & (N - 1)].store(timestamp, std::memory_order_relaxed);
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    // Salin sampai maxEdges edge terbaru, out[0] = terbaru. Mengembalikan
+    // jumlah edge yang disalin (0 jika belum ada atau ISR terus menimpa).
+    int latest(uint32_t* out, int maxEdges) const {
+        if (maxEdges > N - 1) maxEdges = N - 1;
+        for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+            const uint32_t h = head.load(std::memory_order_acquire);
+            const int count = h < uint32_t(maxEdges) ? int(h) : maxEdges;
+            for (int i = 0; i < count; i++) {
+                out[i] = edges[(h - 1 - i) & (N - 1)].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // Valid selama ISR belum memutar ring sampai ke slot tertua yang disalin
+            if (head.load(std::memory_order_relaxed) - h <= uint32_t(N - count)) {
+                return count;
+            }
+        }
+        return 0;
+    }
+
+    // Total edge sejak start (wrap setelah 2^32)
+    uint32_t count() const { return head.load(std::memory_order_acquire); }
+
+private:
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> edges[N];
+};
+
+#endif // PULSE_TIMESTAMP_RING_H
@@ -1,10 +1,13 @@
 #include "RacingTelemetry.h"
+#include "TelemetryLog.h"
+#include "ClockService.h"
+#include <esp_timer.h>
 
 RacingTelemetry::RacingTelemetry()
-    : classifier(nullptr), coolingSystem(nullptr), sensorManager(nullptr),
+    : classifier(nullptr), classificationTask(nullptr), coolingSystem(nullptr), sensorManager(nullptr),
       displayManager(nullptr), buttonHandler(nullptr), recordingManager(nullptr),
       currentStatus(SystemStatus::IDLE), lastUpdate(0), lastClassification(0),
-      currentClassification(0), classificationText("Normal"), serialActive(false),
+      currentClassification(0), classificationText("Normal"), lastResultVersion(0), serialActive(false),
       apiEndpoint("https://http://47.237.23.149:7187/api/telemetry"),
       apiKey("your-api-key-here"), deviceId("racing-001"),
       ssid("YOUR_WIFI_SSID"), password("YOUR_WIFI_PASSWORD")
@@ -48,12 +51,25 @@ void RacingTelemetry::initialize()
         classifier->initialize();
         Serial.println("✓ KNN Classifier initialized");
 
+        classificationTask = &ClassificationTask::getInstance();
+        if (classificationTask->start(classifier))
+        {
+            Serial.println("✓ Classification task started");
+        }
+        else
+        {
+            Serial.println("⚠ Classification task failed - classifying in main loop");
+        }
+
         coolingSystem->initialize();
         Serial.println("✓ Cooling System initialized");
 
         sensorManager->initialize();
         Serial.println("✓ Sensor Manager initialized");
 
+        ClockService::getInstance().begin();
+        Serial.println("✓ GPS Clock initialized");
+
         displayManager->initialize();
         Serial.println("✓ Display Manager initialized");
 
@@ -97,7 +113,7 @@ void RacingTelemetry::initialize()
     classificationText = "Normal";
 
     Serial.println("=== Racing Telemetry System Ready ===");
-    Serial.printf("Training Data: %d samples, K=%d\n", Config::TRAIN_DATA_SIZE, Config::K_VALUE);
+    Serial.printf("Training Data: %u samples, K=%d\n", (unsigned)classifier->getTrainingSize(), Config::K_VALUE);
     Serial.printf("System Status: %d (0=IDLE)\n", static_cast<int>(currentStatus));
     Serial.println("All OOP components initialized successfully!");
     Serial.println("System ready for operation!");
@@ -123,10 +139,16 @@ void RacingTelemetry::update()
         // **PRIORITAS TINGGI: Update input handling PERTAMA dan SELALU**
         buttonHandler->update(); // Ini harus SELALU dipanggil
 
-        // **OPTIMASI 2: Update sensors dengan interval yang lebih efisien**
-        // Sensor update setiap 20ms
+        // **OPTIMASI 2: Update sensors dengan jadwal per channel**
+        // Rate naik saat recording, dan maksimum saat klasifikasi terakhir Critical
+        ScheduleMode scheduleMode = ScheduleMode::IDLE;
+        if (currentClassification == 3)
+            scheduleMode = ScheduleMode::CRITICAL;
+        else if (currentStatus == SystemStatus::RECORDING)
+            scheduleMode = ScheduleMode::RECORDING;
+        sensorManager->setScheduleMode(scheduleMode);
+        ClockService::getInstance().update(); // fix GPS baru -> koreksi jam UTC sebelum sample di-stamp
         sensorManager->update();
-        sensorManager->updateGPS();
 
         // **OPTIMASI 3: Cooling system dengan interval yang wajar**
         static unsigned long lastCoolingUpdate = 0;
@@ -160,6 +182,9 @@ void RacingTelemetry::update()
             // **TAMBAHAN: Auto-send ke API selama recording**
         }
 
+        // AI_RELABEL bertahap (tidak aktif = langsung return)
+        updateRelabel();
+
         // **OPTIMASI 4: AI classification dengan interval yang tepat**
         if (currentTime - lastClassification >= Config::CLASSIFICATION_INTERVAL)
         {
@@ -193,30 +218,35 @@ void RacingTelemetry::update()
 
 void RacingTelemetry::updateAIClassification()
 {
-    unsigned long startTime = millis();
-
-    try
+    // Task KNN di core lain: kirim snapshot terbaru lalu ambil hasil terakhir
+    // yang sudah siap (tertinggal paling banyak satu interval), tanpa menunggu
+    if (classificationTask && classificationTask->isRunning())
     {
-        int newClassification = classifier->classify(sensorManager->getCurrentData());
-        unsigned long executionTime = millis() - startTime;
+        classificationTask->submit(sensorManager->getCurrentData());
 
-        // Update classification if changed
-        if (newClassification != currentClassification)
+        ClassificationResult result;
+        uint32_t version = 0;
+        if (classificationTask->getLatestResult(result, &version) && version != lastResultVersion)
         {
-            currentClassification = newClassification;
-            classificationText = classifier->getClassificationText(currentClassification);
+            lastResultVersion = version;
+            applyClassification(result.classification);
+            classifier->logClassificationResult(result.input, currentClassification,
+                                                result.executionMicros);
+        }
+        return;
+    }
 
-            Serial.printf("AI Classification changed to: %s\n", classificationText.c_str());
+    unsigned long startTime = micros();
 
-            // Handle critical classification
-            if (currentClassification == 2)
-            { // Critical
-                Serial.println("WARNING: AI detected critical engine condition!");
-            }
-        }
+    try
+    {
+        int newClassification = classifier->classify(sensorManager->getCurrentData());
+        unsigned long executionMicros = micros() - startTime;
+
+        applyClassification(newClassification);
 
         classifier->logClassificationResult(sensorManager->getCurrentData(),
-                                            currentClassification, executionTime);
+                                            currentClassification, executionMicros);
     }
     catch (...)
     {
@@ -226,6 +256,24 @@ void RacingTelemetry::updateAIClassification()
     }
 }
 
+void RacingTelemetry::applyClassification(int newClassification)
+{
+    // Update classification if changed
+    if (newClassification != currentClassification)
+    {
+        currentClassification = newClassification;
+        classificationText = classifier->getClassificationText(currentClassification);
+
+        Serial.printf("AI Classification changed to: %s\n", classificationText.c_str());
+
+        // Handle critical classification
+        if (currentClassification == 2)
+        { // Critical
+            Serial.println("WARNING: AI detected critical engine condition!");
+        }
+    }
+}
+
 void RacingTelemetry::handleEmergencyCondition(const String &reason)
 {
     Serial.printf("EMERGENCY CONDITION: %s\n", reason.c_str());
@@ -349,7 +397,47 @@ void RacingTelemetry::handleSerialCommand(const String &command)
     }
     else if (cmd == "AI")
     {
+        classificationTask->lockClassifier();
         printAIStatus();
+        classificationTask->unlockClassifier();
+    }
+    else if (cmd.startsWith("AI_BACKEND"))
+    {
+        classificationTask->lockClassifier();
+        selectAIBackend(cmd);
+        classificationTask->unlockClassifier();
+    }
+    else if (cmd.startsWith("AI_CACHE"))
+    {
+        classificationTask->lockClassifier();
+        handleAICacheCommand(cmd);
+        classificationTask->unlockClassifier();
+    }
+    else if (cmd.startsWith("AI_MODEL"))
+    {
+        classificationTask->lockClassifier();
+        handleAIModelCommand(cmd);
+        classificationTask->unlockClassifier();
+    }
+    else if (cmd == "AI_RELABEL")
+    {
+        relabelRecording();
+    }
+    else if (cmd.startsWith("BENCH_AI"))
+    {
+        benchmarkAI(cmd);
+    }
+    else if (cmd.startsWith("AI_LEARN"))
+    {
+        handleAILearnCommand(cmd);
+    }
+    else if (cmd.startsWith("SENSOR_CAL"))
+    {
+        handleSensorCalibrationCommand(cmd);
+    }
+    else if (cmd.startsWith("SENSOR_SOURCE"))
+    {
+        handleSensorSourceCommand(cmd);
     }
     else if (cmd == "WIFI_STATUS")
     {
@@ -448,6 +536,10 @@ String RacingTelemetry::prepareTelemetryJSON()
     // Device information
     doc["device_id"] = deviceId;
     doc["timestamp"] = millis();
+    doc["sample_timestamp_us"] = data.timestampMicros; // waktu akuisisi sample, bukan waktu kirim
+    if (data.utcMicros != 0)
+        doc["sample_utc_us"] = data.utcMicros;          // absolut, untuk join antar device di server
+    doc["channels"] = data.channels;                   // mask SensorChannel yang segar di sample ini
     doc["system_status"] = getStatusText();
     doc["lap_number"] = recordingManager->getCurrentLap();
 
@@ -588,6 +680,17 @@ void RacingTelemetry::printGPSStatus()
     {
         Serial.println("No GPS fix available");
     }
+
+    GpsReceiver &receiver = GpsReceiver::getInstance();
+    GpsFix fix = {};
+    receiver.getLatestFix(fix);
+    Serial.printf("Receiver: %s, %lu baud, fixes %u, last fix %lu ms ago\n",
+                  receiver.isRunning() ? "running" : "stopped", (unsigned long)receiver.getBaudRate(),
+                  (unsigned)fix.sequence,
+                  fix.sequence > 0 ? (unsigned long)((esp_timer_get_time() - fix.arrivalMicros) / 1000) : 0UL);
+    Serial.printf("NMEA: %u ok, %u bad checksum, %u UART overflows\n", (unsigned)receiver.getPassedSentences(),
+                  (unsigned)receiver.getFailedSentences(), (unsigned)receiver.getOverflows());
+    ClockService::getInstance().printStatus();
 }
 
 void RacingTelemetry::printSensorStatus()
@@ -601,18 +704,419 @@ void RacingTelemetry::printSensorStatus()
     Serial.printf("MAP: %.1f kPa\n", data.map_value);
     Serial.printf("Incline: %.1f°\n", data.incline);
     Serial.printf("Stroke: %.1f mm\n", data.stroke);
-    Serial.printf("Timestamp: %lu\n", data.timestamp);
+    Serial.printf("Timestamp: %lld us, fresh channels 0x%02x\n", (long long)data.timestampMicros,
+                  (unsigned)data.channels);
+    Serial.printf("Source: %s, samples published %u, recording dropped %u\n", sensorManager->getSourceName(),
+                  (unsigned)sensorManager->getSampleCount(), (unsigned)recordingManager->getDroppedSamples());
+    sensorManager->printSchedule();
+
+    AdcSampler &adc = AdcSampler::getInstance();
+    AdcFrame frame;
+    if (adc.isRunning() && adc.getLatestFrame(frame))
+    {
+        Serial.printf("ADC DMA: frame #%u, samples AFR=%u MAP=%u TPS=%u INC=%u STR=%u, overruns %u\n",
+                      (unsigned)frame.sequence, frame.samples[0], frame.samples[1], frame.samples[2],
+                      frame.samples[3], frame.samples[4], (unsigned)adc.getOverruns());
+        Serial.printf("ADC raw/filtered: AFR %.0f/%.0f MAP %.0f/%.0f TPS %.0f/%.0f INC %.0f/%.0f STR %.0f/%.0f\n",
+                      frame.raw[0], frame.filtered[0], frame.raw[1], frame.filtered[1], frame.raw[2], frame.filtered[2],
+                      frame.raw[3], frame.filtered[3], frame.raw[4], frame.filtered[4]);
+    }
+    else
+    {
+        Serial.println("ADC DMA: not running (analogRead)");
+    }
 }
 
 void RacingTelemetry::printAIStatus()
 {
     Serial.println("=== AI STATUS ===");
     Serial.printf("Current Classification: %d (%s)\n", currentClassification, classificationText.c_str());
-    Serial.printf("Training Data Size: %d\n", Config::TRAIN_DATA_SIZE);
+    Serial.printf("Training Data Size: %u (%s)\n", (unsigned)classifier->getTrainingSize(),
+                  classifier->isFileModel() ? "model file" : "compiled-in");
     Serial.printf("K-Value: %d\n", Config::K_VALUE);
+    Serial.printf("Backend: %s\n", KNNClassifier::getBackendName(classifier->getBackend()));
+    classifier->printCacheStats();
     Serial.printf("Last Classification: %lu ms ago\n", millis() - lastClassification);
 }
 
+void RacingTelemetry::selectAIBackend(const String &command)
+{
+    // Format: AI_BACKEND atau AI_BACKEND <FLOAT|QUANT|KDTREE|GRID>
+    String name = command.substring(String("AI_BACKEND").length());
+    name.trim();
+
+    if (name.length() > 0 && !classifier->setBackendByName(name))
+    {
+        Serial.printf("Cannot select AI backend: '%s' (use FLOAT, QUANT, KDTREE or GRID)\n", name.c_str());
+        return;
+    }
+    Serial.printf("AI backend: %s\n", KNNClassifier::getBackendName(classifier->getBackend()));
+    if (classifier->getBackend() == KnnBackend::DECISION_GRID)
+    {
+        // Grid hanya approximation dari KNN: tampilkan error terukur dari generator
+        Serial.printf("WARNING: GRID is an approximate backend - differs from exact KNN on %.1f%% of "
+                      "near-data and %.1f%% of uniform inputs\n",
+                      KnnDecisionGridData::NEAR_ERROR_PERCENT, KnnDecisionGridData::UNIFORM_ERROR_PERCENT);
+    }
+}
+
+void RacingTelemetry::handleAICacheCommand(const String &command)
+{
+    // Format: AI_CACHE atau AI_CACHE <ON|OFF|RESET>
+    String option = command.substring(String("AI_CACHE").length());
+    option.trim();
+
+    if (option == "ON")
+    {
+        classifier->setCacheEnabled(true);
+    }
+    else if (option == "OFF")
+    {
+        classifier->setCacheEnabled(false);
+    }
+    else if (option == "RESET")
+    {
+        classifier->resetCacheStats();
+    }
+    else if (option.length() > 0)
+    {
+        Serial.printf("Unknown AI_CACHE option: '%s' (use ON, OFF or RESET)\n", option.c_str());
+        return;
+    }
+    classifier->printCacheStats();
+}
+
+void RacingTelemetry::handleAIModelCommand(const String &command)
+{
+    // Format: AI_MODEL atau AI_MODEL <RELOAD|BUILTIN>
+    String option = command.substring(String("AI_MODEL").length());
+    option.trim();
+
+    if (option == "RELOAD")
+    {
+        classifier->loadModelFile();
+    }
+    else if (option == "BUILTIN")
+    {
+        classifier->useBuiltinModel();
+    }
+    else if (option.length() > 0)
+    {
+        Serial.printf("Unknown AI_MODEL option: '%s' (use RELOAD or BUILTIN)\n", option.c_str());
+        return;
+    }
+    classifier->printModelInfo();
+}
+
+bool RacingTelemetry::learnCurrentSample(int label)
+{
+    // Snapshot sensor saat ini dijadikan sample berlabel (serial AI_LEARN / tombol SELECT)
+    const SensorData &data = sensorManager->getCurrentData();
+
+    classificationTask->lockClassifier();
+    const int slot = classifier->learnSample(data, label);
+    const uint32_t count = classifier->getOnlineSampleCount();
+    classificationTask->unlockClassifier();
+
+    if (slot < 0)
+    {
+        Serial.printf("ERROR: Invalid class %d (0-%d)\n", label, Config::NUM_CLASSES - 1);
+        return false;
+    }
+    Serial.printf("Learned sample: class %d in slot %d (%u/%d) - AFR=%.1f RPM=%.0f TPS=%.1f Temp=%.1f\n",
+                  label, slot, (unsigned)count, Config::ONLINE_SAMPLE_CAPACITY,
+                  data.afr, data.rpm, data.tps, data.temp);
+    return true;
+}
+
+void RacingTelemetry::handleAILearnCommand(const String &command)
+{
+    // Format: AI_LEARN, AI_LEARN <0-3>, AI_LEARN CLEAR, AI_LEARN POLICY <OLDEST|BALANCED>
+    String option = command.substring(String("AI_LEARN").length());
+    option.trim();
+
+    if (option.length() == 0)
+    {
+        classificationTask->lockClassifier();
+        classifier->printOnlineStats();
+        classificationTask->unlockClassifier();
+    }
+    else if (option == "CLEAR")
+    {
+        classificationTask->lockClassifier();
+        classifier->clearOnlineSamples();
+        classificationTask->unlockClassifier();
+        Serial.println("Online samples cleared");
+    }
+    else if (option.startsWith("POLICY"))
+    {
+        String policy = option.substring(String("POLICY").length());
+        policy.trim();
+        if (policy != "OLDEST" && policy != "BALANCED")
+        {
+            Serial.printf("Unknown eviction policy: '%s' (use OLDEST or BALANCED)\n", policy.c_str());
+            return;
+        }
+        classificationTask->lockClassifier();
+        classifier->setEvictionPolicy(policy == "OLDEST" ? KnnEvictionPolicy::OLDEST
+                                                         : KnnEvictionPolicy::CLASS_BALANCED);
+        classifier->printOnlineStats();
+        classificationTask->unlockClassifier();
+    }
+    else if (option.length() == 1 && isDigit(option[0]))
+    {
+        learnCurrentSample(option.toInt());
+    }
+    else
+    {
+        Serial.printf("Unknown AI_LEARN option: '%s' (use 0-%d, CLEAR, POLICY)\n", option.c_str(),
+                      Config::NUM_CLASSES - 1);
+    }
+}
+
+void RacingTelemetry::handleSensorCalibrationCommand(const String &command)
+{
+    // Format: SENSOR_CAL atau SENSOR_CAL <RELOAD|DEFAULT>
+    String option = command.substring(String("SENSOR_CAL").length());
+    option.trim();
+    HardwareSensorSource &hardware = HardwareSensorSource::getInstance();
+
+    if (option == "RELOAD")
+    {
+        hardware.loadCalibration();
+    }
+    else if (option == "DEFAULT")
+    {
+        hardware.useDefaultCalibration();
+    }
+    else if (option.length() > 0)
+    {
+        Serial.printf("Unknown SENSOR_CAL option: '%s' (use RELOAD or DEFAULT)\n", option.c_str());
+        return;
+    }
+    hardware.printCalibration();
+}
+
+void RacingTelemetry::handleSensorSourceCommand(const String &command)
+{
+    // Format: SENSOR_SOURCE, SENSOR_SOURCE HW|SIM, SENSOR_SOURCE REPLAY [FAST]
+    String option = command.substring(String("SENSOR_SOURCE").length());
+    option.trim();
+
+    if (option.length() == 0)
+    {
+        Serial.printf("Sensor source: %s\n", sensorManager->getSourceName());
+    }
+    else if (option == "HW")
+    {
+        sensorManager->setSource(SensorSourceType::HARDWARE);
+    }
+    else if (option == "SIM")
+    {
+        sensorManager->setSource(SensorSourceType::SIMULATED);
+    }
+    else if (option == "REPLAY" || option == "REPLAY FAST")
+    {
+        if (recordingManager->getIsRecording())
+        {
+            Serial.println("ERROR: Cannot replay while recording (same SPIFFS file)");
+            return;
+        }
+        sensorManager->setSource(SensorSourceType::REPLAY, option == "REPLAY FAST");
+    }
+    else
+    {
+        Serial.printf("Unknown SENSOR_SOURCE option: '%s' (use HW, SIM, REPLAY [FAST])\n", option.c_str());
+    }
+}
+
+void RacingTelemetry::benchmarkAI(const String &command)
+{
+    // Format: BENCH_AI atau BENCH_AI <runs>; semua backend, input sintetis tetap
+    String option = command.substring(String("BENCH_AI").length());
+    option.trim();
+    long runs = option.length() > 0 ? option.toInt() : Config::BENCH_AI_RUNS;
+    if (runs < 1 || runs > Config::BENCH_AI_MAX_RUNS)
+    {
+        Serial.printf("ERROR: runs must be 1-%d\n", Config::BENCH_AI_MAX_RUNS);
+        return;
+    }
+
+    float *samples = new (std::nothrow) float[runs];
+    if (!samples)
+    {
+        Serial.println("ERROR: Not enough memory for benchmark");
+        return;
+    }
+
+    static const KnnBackend backends[] = {KnnBackend::FLOAT_SCAN, KnnBackend::QUANTIZED,
+                                          KnnBackend::KD_TREE, KnnBackend::DECISION_GRID};
+    Serial.printf("\n=== BENCH_AI: %ld runs/backend, %d inputs, no cache ===\n", runs, KNN_BENCH_INPUTS);
+    Serial.println("backend      min_us  median_us     p99_us     max_us    mean_us");
+    for (KnnBackend backend : backends)
+    {
+        // Lock per backend: task klasifikasi hanya tertahan selama satu backend
+        KnnBenchStats stats;
+        classificationTask->lockClassifier();
+        const bool ok = classifier->benchmark(backend, uint32_t(runs), samples, stats);
+        classificationTask->unlockClassifier();
+
+        if (!ok)
+        {
+            Serial.printf("%-8s   (not available)\n", KNNClassifier::getBackendName(backend));
+            continue;
+        }
+        Serial.printf("%-8s %10.1f %10.1f %10.1f %10.1f %10.1f\n", KNNClassifier::getBackendName(backend),
+                      stats.minMicros, stats.medianMicros, stats.p99Micros, stats.maxMicros, stats.meanMicros);
+    }
+    delete[] samples;
+
+    // Bench berjalan di task loop; inference normal di task klasifikasi
+    Serial.printf("Stack high-water: loop task %u bytes free", (unsigned)uxTaskGetStackHighWaterMark(nullptr));
+    if (classificationTask->isRunning())
+    {
+        Serial.printf(", classification task %u / %d bytes free", (unsigned)classificationTask->getStackHighWaterMark(),
+                      Config::CLASSIFICATION_TASK_STACK);
+    }
+    Serial.println();
+}
+
+// AI_RELABEL berjalan bertahap dari update(): paling banyak AI_RELABEL_LINES_PER_LOOP
+// baris per loop, jadi telemetry, display dan recording tidak tertahan. Buffer static
+// (seperti BENCH_AI): KNN_BATCH_BLOCK SensorData dan tabel per lap terlalu besar untuk stack loop.
+namespace
+{
+struct RelabelJob
+{
+    static const int MAX_LAPS = 32;
+    File file;
+    bool active;
+    uint32_t lapCounts[MAX_LAPS + 1][Config::NUM_CLASSES];
+    SensorData rows[KNN_BATCH_BLOCK];
+    int labels[KNN_BATCH_BLOCK];
+    size_t blockSize;
+    uint32_t totalRows;
+    uint32_t classifyMicros;
+    unsigned long startMillis;
+};
+
+RelabelJob relabelJob;
+} // namespace
+
+void RacingTelemetry::relabelRecording()
+{
+    // Klasifikasi ulang seluruh rekaman dengan model aktif (mis. setelah AI_MODEL RELOAD)
+    if (relabelJob.active)
+    {
+        Serial.printf("AI relabel in progress: %u rows so far\n", (unsigned)relabelJob.totalRows);
+        return;
+    }
+    if (currentStatus == SystemStatus::RECORDING)
+    {
+        Serial.println("ERROR: Cannot relabel while recording");
+        return;
+    }
+
+    relabelJob.file = SPIFFS.open(recordingManager->getDataFileName(), "r");
+    if (!relabelJob.file)
+    {
+        Serial.println("ERROR: No recorded data file");
+        return;
+    }
+
+    memset(relabelJob.lapCounts, 0, sizeof(relabelJob.lapCounts));
+    relabelJob.blockSize = 0;
+    relabelJob.totalRows = 0;
+    relabelJob.classifyMicros = 0;
+    relabelJob.startMillis = millis();
+    relabelJob.active = true;
+
+    Serial.printf("=== AI RELABEL (%s backend, %u samples) ===\n",
+                  KNNClassifier::getBackendName(classifier->getBackend()), (unsigned)classifier->getTrainingSize());
+}
+
+void RacingTelemetry::classifyRelabelBlock()
+{
+    // Lock per blok supaya task klasifikasi live tidak tertahan lama
+    classificationTask->lockClassifier();
+    unsigned long start = micros();
+    classifier->classifyBatch(relabelJob.rows, relabelJob.blockSize, relabelJob.labels);
+    relabelJob.classifyMicros += micros() - start;
+    classificationTask->unlockClassifier();
+
+    for (size_t i = 0; i < relabelJob.blockSize; i++)
+    {
+        int lap = relabelJob.rows[i].lapNumber;
+        if (lap < 0 || lap > RelabelJob::MAX_LAPS)
+        {
+            lap = 0;
+        }
+        relabelJob.lapCounts[lap][relabelJob.labels[i]]++;
+    }
+    relabelJob.totalRows += relabelJob.blockSize;
+    relabelJob.blockSize = 0;
+}
+
+void RacingTelemetry::updateRelabel()
+{
+    if (!relabelJob.active)
+    {
+        return;
+    }
+
+    // Satu potongan per loop; blok penuh langsung diklasifikasi
+    for (int line = 0; line < Config::AI_RELABEL_LINES_PER_LOOP && relabelJob.file.available(); line++)
+    {
+        String text = relabelJob.file.readStringUntil('\n');
+        if (parseTelemetryLogLine(text.c_str(), relabelJob.rows[relabelJob.blockSize]) &&
+            ++relabelJob.blockSize == KNN_BATCH_BLOCK)
+        {
+            classifyRelabelBlock();
+        }
+    }
+    if (relabelJob.file.available())
+    {
+        return;
+    }
+
+    if (relabelJob.blockSize > 0)
+    {
+        classifyRelabelBlock();
+    }
+    relabelJob.file.close();
+    relabelJob.active = false;
+
+    for (int lap = 0; lap <= RelabelJob::MAX_LAPS; lap++)
+    {
+        uint32_t lapTotal = 0;
+        for (int c = 0; c < Config::NUM_CLASSES; c++)
+        {
+            lapTotal += relabelJob.lapCounts[lap][c];
+        }
+        if (lapTotal == 0)
+        {
+            continue;
+        }
+        Serial.printf("Lap %d: %u rows - Normal=%u Startup=%u Maintenance=%u Critical=%u\n", lap,
+                      (unsigned)lapTotal, (unsigned)relabelJob.lapCounts[lap][0], (unsigned)relabelJob.lapCounts[lap][1],
+                      (unsigned)relabelJob.lapCounts[lap][2], (unsigned)relabelJob.lapCounts[lap][3]);
+    }
+    Serial.printf("Relabelled %u rows in %lu ms, classify %.1f ms (%.0f rows/s)\n", (unsigned)relabelJob.totalRows,
+                  millis() - relabelJob.startMillis, relabelJob.classifyMicros / 1000.0f,
+                  relabelJob.classifyMicros > 0 ? relabelJob.totalRows * 1e6f / relabelJob.classifyMicros : 0.0f);
+}
+
+void RacingTelemetry::cancelRelabel()
+{
+    if (!relabelJob.active)
+    {
+        return;
+    }
+    relabelJob.file.close();
+    relabelJob.active = false;
+    Serial.printf("AI relabel cancelled after %u rows\n", (unsigned)relabelJob.totalRows);
+}
+
 void RacingTelemetry::printWiFiStatus()
 {
     Serial.println("=== WIFI STATUS ===");
@@ -643,6 +1147,14 @@ void RacingTelemetry::printHelpMenu()
     Serial.println("GPS            - Show GPS status");
     Serial.println("SENSORS        - Show sensor readings");
     Serial.println("AI             - Show AI classification status");
+    Serial.println("AI_BACKEND [n] - Show/set KNN backend (FLOAT, QUANT, KDTREE exact; GRID approximate)");
+    Serial.println("AI_CACHE [opt] - Show cache hit/miss stats (ON, OFF, RESET)");
+    Serial.println("AI_MODEL [opt] - Show KNN model source (RELOAD file, BUILTIN)");
+    Serial.println("AI_RELABEL     - Re-classify recorded data with the active model (runs in background)");
+    Serial.println("BENCH_AI [n]   - Benchmark all KNN backends (min/median/p99/max us)");
+    Serial.println("AI_LEARN [opt] - Label current reading (0-3), CLEAR, POLICY OLDEST|BALANCED");
+    Serial.println("SENSOR_CAL [opt] - Show sensor calibration (RELOAD file, DEFAULT curves)");
+    Serial.println("SENSOR_SOURCE [HW|SIM|REPLAY [FAST]] - Switch sensor input (replays recorded file)");
     Serial.println("WIFI_STATUS    - Show WiFi connection status");
     Serial.println("API_TEST       - Test API connection");
     Serial.println("HELP           - Show this help menu");
@@ -769,7 +1281,8 @@ void RacingTelemetry::startRecording()
         Serial.println("WARNING: High temperature detected before recording!");
     }
 
-    // Start recording
+    // Start recording (SPIFFS di-format: file yang sedang di-relabel hilang)
+    cancelRelabel();
     currentStatus = SystemStatus::RECORDING;
     recordingManager->startRecording();
     displayManager->exitMenu();
@@ -3,6 +3,7 @@
 
 #include "DataStructures.h"
 #include "KNNClassifier.h"
+#include "ClassificationTask.h"
 #include "CoolingSystem.h"
 #include "SensorManager.h"
 #include "DisplayManager.h"
@@ -20,6 +21,7 @@ class RacingTelemetry {
 private:
     // === SYSTEM COMPONENTS ===
     KNNClassifier* classifier;          // AI classification engine
+    ClassificationTask* classificationTask; // KNN inference task (core lain)
     CoolingSystem* coolingSystem;       // Intelligent cooling management
     SensorManager* sensorManager;       // Sensor data collection
     DisplayManager* displayManager;     // Animated display controller
@@ -38,6 +40,7 @@ private:
     // === AI CLASSIFICATION STATE ===
     int currentClassification;          // Current AI classification result
     String classificationText;          // Human-readable classification
+    uint32_t lastResultVersion;         // Versi hasil task terakhir yang diproses
     
     // === API CONFIGURATION ===
     String apiEndpoint;
@@ -48,6 +51,7 @@ private:
     
     // === PRIVATE METHODS ===
     void updateAIClassification();
+    void applyClassification(int newClassification);
     void handleEmergencyCondition(const String& reason);
     void handleSerialCommand(const String& command);
     String getStatusText() const;
@@ -66,6 +70,17 @@ private:
     void printGPSStatus();
     void printSensorStatus();
     void printAIStatus();
+    void selectAIBackend(const String& command);
+    void handleAICacheCommand(const String& command);
+    void handleAIModelCommand(const String& command);
+    void relabelRecording();
+    void classifyRelabelBlock();
+    void updateRelabel();
+    void cancelRelabel();
+    void handleAILearnCommand(const String& command);
+    void handleSensorCalibrationCommand(const String& command);
+    void handleSensorSourceCommand(const String& command);
+    void benchmarkAI(const String& command);
     void printWiFiStatus();        // ← TAMBAHAN INI
     void printHelpMenu();
     void performSystemReset();
@@ -95,6 +110,9 @@ public:
     void stopRecording();
     void transmitData();
     
+    // === ONLINE LEARNING ===
+    bool learnCurrentSample(int label);
+    
     // === MENU SYSTEM CONTROL ===
     void enterMenu();
     void exitMenu();
@@ -2,12 +2,15 @@
 #include "SensorManager.h"
 #include "CoolingSystem.h"
 #include "SystemMonitor.h"
+#include "KNNClassifier.h"
+#include "TelemetryLog.h"
+#include "ClockService.h"
 
 RecordingManager::RecordingManager()
     : isRecording(false), isTransmitting(false), currentLap(1),
       currentLapDistance(0.0f), lastLat(0.0), lastLng(0.0), hasLastPosition(false),
       firstLapLat(0.0), firstLapLng(0.0), firstLapSet(false), lapStartTime(0),
-      lapConfig(nullptr), dataFileName("/telemetry_data.txt")
+      lapConfig(nullptr), samplesRecorded(0), dataFileName("/telemetry_data.txt")
 {
 
     // Initialize statistics
@@ -86,6 +89,14 @@ void RecordingManager::startRecording()
 
     Serial.println("=== STARTING RECORDING ===");
 
+    // File replay ikut terhapus oleh format; kembali ke sensor hardware dulu
+    SensorManager &sensors = SensorManager::getInstance();
+    if (sensors.getSourceType() == SensorSourceType::REPLAY)
+    {
+        Serial.println("Replay stopped: SPIFFS will be formatted");
+        sensors.setSource(SensorSourceType::HARDWARE);
+    }
+
     // **HAPUS SEMUA DATA SPIFFS LAMA**
     Serial.println("Clearing all SPIFFS data...");
     if (!SPIFFS.format())
@@ -95,6 +106,22 @@ void RecordingManager::startRecording()
     }
     Serial.println("SPIFFS formatted successfully - all old data cleared");
 
+    // Model KNN dan online samples ikut terhapus oleh format; tulis ulang dari RAM
+    KNNClassifier &classifier = KNNClassifier::getInstance();
+    if (classifier.isFileModel() && !classifier.saveModelFile())
+    {
+        Serial.println("WARNING: Failed to restore KNN model file - compiled-in model after reboot");
+    }
+    if (classifier.getOnlineSampleCount() > 0 && !classifier.saveOnlineSamples())
+    {
+        Serial.println("WARNING: Failed to restore online samples file");
+    }
+    HardwareSensorSource &hardware = HardwareSensorSource::getInstance();
+    if (hardware.hasCustomCalibration() && !hardware.saveCalibration())
+    {
+        Serial.println("WARNING: Failed to restore sensor calibration file");
+    }
+
     // Start cooling system if not active
     CoolingSystem &cooling = CoolingSystem::getInstance();
     if (!cooling.isSystemActive())
@@ -104,6 +131,8 @@ void RecordingManager::startRecording()
     }
 
     // Reset recording state
+    sensors.attachSampleCursor(sampleCursor);
+    samplesRecorded = 0;
     isRecording = true;
     currentLap = 1;
     currentLapDistance = 0.0f;
@@ -149,6 +178,8 @@ void RecordingManager::stopRecording()
         completeLap();
     }
 
+    // Sample yang masih di stream ikut direkam sebelum file ditutup
+    saveCurrentSensorData();
     isRecording = false;
 
     // Close data file with summary
@@ -330,24 +361,40 @@ void RecordingManager::saveCurrentSensorData()
         return;
 
     SensorManager &sensors = SensorManager::getInstance();
-    const SensorData &data = sensors.getCurrentData();
 
-    // Update current lap statistics
-    currentLapStats.update(data);
+    // Semua sample baru sejak panggilan terakhir, masing-masing tepat sekali
+    SensorData data;
+    if (!sensors.readNextSample(sampleCursor, data))
+        return;
 
-    // Update overall statistics
-    overallStats.update(data);
+    // Satu open/close per batch: rate sample naik sampai 50 Hz saat Critical
+    File file = SPIFFS.open(dataFileName, "a");
+    if (!file)
+    {
+        Serial.println("ERROR: Failed to open file for appending data");
+        return;
+    }
+    do
+    {
+        // Update current lap statistics
+        currentLapStats.update(data);
 
-    // Save to file
-    appendDataToFile(data);
+        // Update overall statistics
+        overallStats.update(data);
+
+        // Save to file
+        appendDataToFile(file, data);
+        samplesRecorded++;
+    } while (sensors.readNextSample(sampleCursor, data));
+    file.close();
 
     // Debug output occasionally
     static unsigned long lastDebug = 0;
     if (millis() - lastDebug > 10000)
     { // Every 10 seconds
-        Serial.printf("Recording - Lap: %d, Time: %lu s, Temp: %.1f°C, Speed: %.1f km/h\n",
+        Serial.printf("Recording - Lap: %d, Time: %lu s, Temp: %.1f°C, Speed: %.1f km/h, Samples: %u (%u dropped)\n",
                       currentLap, (millis() - lapStartTime) / 1000,
-                      data.temp, data.speed);
+                      data.temp, data.speed, (unsigned)samplesRecorded, (unsigned)sampleCursor.overruns);
         lastDebug = millis();
     }
 }
@@ -369,12 +416,20 @@ void RecordingManager::createDataFile()
         return;
     }
 
-    // Write CSV header
-    file.println("timestamp,lapNumber,afr,rpm,temperature,tps,map,latitude,longitude,speed,incline,stroke");
+    // Write CSV header (urutan kolom sama dengan appendDataToFile)
+    file.println("lapNumber,afr,rpm,temperature,tps,map,latitude,longitude,speed,incline,stroke,timestamp,utc");
 
     // Write recording metadata
     file.printf("# Recording started at: %lu\n", millis());
     file.printf("# System timestamp: %s\n", String(millis()).c_str());
+    file.printf("%s\n", TELEMETRY_LOG_MICROS_MARKER);
+
+    // Waktu absolut sesi: merge antar motor cukup sort kolom utc
+    ClockService &clock = ClockService::getInstance();
+    char utcStart[32];
+    clock.formatNow(utcStart, sizeof(utcStart));
+    file.printf("# UTC start: %s\n", utcStart);
+    file.printf("# Clock: %s\n", clock.getStateText());
 
     if (lapConfig)
     {
@@ -399,18 +454,11 @@ void RecordingManager::createDataFile()
     Serial.println("Data file created successfully");
 }
 
-void RecordingManager::appendDataToFile(const SensorData &data)
+void RecordingManager::appendDataToFile(File &file, const SensorData &data)
 {
-    File file = SPIFFS.open(dataFileName, "a");
-    if (!file)
-    {
-        Serial.println("ERROR: Failed to open file for appending data");
-        return;
-    }
-
     // **PERBAIKAN 1: Format sesuai dengan Qt application requirements**
-    // lapNumber,afr,rpm,temp,tps,map,lat,lng,speed,incline,stroke,timestamp
-    file.printf("%d,%.1f,%.0f,%.0f,%.0f,%.0f,%.4f,%.4f,%.0f,%.0f,%.0f,%lu\n",
+    // lapNumber,afr,rpm,temp,tps,map,lat,lng,speed,incline,stroke,timestamp,utc
+    file.printf("%d,%.1f,%.0f,%.0f,%.0f,%.0f,%.4f,%.4f,%.0f,%.0f,%.0f,%lld,%lld\n",
                 currentLap,     // lapNumber (integer)
                 data.afr,       // afr (1 decimal)
                 data.rpm,       // rpm (no decimal)
@@ -422,16 +470,10 @@ void RecordingManager::appendDataToFile(const SensorData &data)
                 data.speed,     // speed (no decimal)
                 data.incline,   // incline (no decimal)
                 data.stroke,    // stroke (no decimal, FIXED trailing comma)
-                millis()        // timestamp (moved to end, no trailing comma)
+                (long long)data.timestampMicros, // timestamp us saat akuisisi
+                (long long)data.utcMicros        // utc us (0 = jam GPS belum sinkron, no trailing comma)
     );
 
-    // **PERBAIKAN 2: Error handling dan validation**
-
-    file.close();
-
-    // **PERBAIKAN 4: Periodic status update**
-    static unsigned long lastStatusUpdate = 0;
-    unsigned long currentTime = millis();
 }
 
 void RecordingManager::appendLapSummaryToFile(int lapNumber, unsigned long lapTime)
@@ -472,6 +514,7 @@ void RecordingManager::closeDataFile()
     file.printf("#   Max Speed: %.1f km/h\n", overallStats.maxSpeed);
     file.printf("#   Max RPM: %.0f\n", overallStats.maxRPM);
     file.printf("#   Max Temperature: %.1f°C\n", overallStats.maxTemp);
+    file.printf("#   Samples: %u recorded, %u dropped\n", (unsigned)samplesRecorded, (unsigned)sampleCursor.overruns);
     file.printf("#   File Size: %d bytes\n", file.size());
 
     file.close();
@@ -675,7 +718,7 @@ void RecordingManager::transmitLiveSensorData()
     const SensorData &data = sensors.getCurrentData();
 
     // Kirim format CSV persis dengan appendDataToFile()
-    Serial.printf("%d,%.1f,%.0f,%.0f,%.0f,%.0f,%.4f,%.4f,%.0f,%.0f,%.0f,%lu\n",
+    Serial.printf("%d,%.1f,%.0f,%.0f,%.0f,%.0f,%.4f,%.4f,%.0f,%.0f,%.0f,%lld,%lld\n",
                   currentLap,     // lapNumber
                   data.afr,       // AFR
                   data.rpm,       // RPM
@@ -687,7 +730,8 @@ void RecordingManager::transmitLiveSensorData()
                   data.speed,
                   data.incline,
                   data.stroke, // Speed
-                  millis());   // Timestamp sistem
+                  (long long)data.timestampMicros, // Timestamp us saat akuisisi
+                  (long long)data.utcMicros);      // UTC us
 }
 
 void RecordingManager::pauseRecording()
@@ -710,6 +754,8 @@ void RecordingManager::resumeRecording()
         return;
     }
 
+    // Sample selama pause tidak direkam dan bukan overrun
+    SensorManager::getInstance().attachSampleCursor(sampleCursor);
     isRecording = true;
     Serial.println("Recording RESUMED");
 }
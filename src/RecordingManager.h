@@ -2,6 +2,7 @@
 #define RECORDING_MANAGER_H
 
 #include "DataStructures.h"
+#include "SampleRing.h"
 #include "SPIFFS.h"
 
 class RecordingManager {
@@ -20,6 +21,8 @@ private:
     LapConfiguration* lapConfig;
     LapStatistics currentLapStats;
     LapStatistics overallStats;
+    SampleCursor sampleCursor;      // posisi di stream SensorManager, setiap sample direkam sekali
+    uint32_t samplesRecorded;
     
     String dataFileName;
     String serialCmd;
@@ -27,7 +30,7 @@ private:
     // Private methods
     void initializeLapDetection();
     void createDataFile();
-    void appendDataToFile(const SensorData& data);
+    void appendDataToFile(File& file, const SensorData& data);
     void appendLapSummaryToFile(int lapNumber, unsigned long lapTime);
     void closeDataFile();
     double calculateDistance(double lat1, double lng1, double lat2, double lng2);
@@ -55,6 +58,7 @@ public:
     
     // Getters - sesuai dengan yang diperlukan DisplayManager
     bool getIsRecording() const { return isRecording; }
+    uint32_t getDroppedSamples() const { return sampleCursor.overruns; }
     bool getIsTransmitting() const { return isTransmitting; }
     int getCurrentLap() const { return currentLap; }
     float getCurrentLapDistance() const { return currentLapDistance; }
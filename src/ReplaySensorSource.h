@@ -0,0 +1,127 @@
+#ifndef REPLAY_SENSOR_SOURCE_H
+#define REPLAY_SENSOR_SOURCE_H
+
+#include <stddef.h>
+#include "SensorSource.h"
+#include "TelemetryLog.h"
+
+// ReplaySensorSource.h
+// Memutar ulang file rekaman (format TelemetryLog.h) sebagai sumber sensor.
+// REAL_TIME mengikuti selisih timestamp asli (1x, rekaman us atau ms lama),
+// AS_FAST_AS_POSSIBLE
+// mengeluarkan satu baris setiap read(). Baris dibaca lewat
+// ITextLineReader supaya sama di firmware (File SPIFFS) dan host (FILE*).
+
+class ITextLineReader {
+public:
+    virtual ~ITextLineReader() {}
+    // Satu baris tanpa jaminan newline; false di akhir file
+    virtual bool readLine(char* buffer, size_t size) = 0;
+};
+
+enum class ReplaySpeed {
+    REAL_TIME = 0,
+    AS_FAST_AS_POSSIBLE = 1
+};
+
+class ReplaySensorSource : public ISensorSource {
+public:
+    ReplaySensorSource(ITextLineReader& reader, ReplaySpeed speed)
+        : reader(reader), speed(speed), pendingValid(false), ended(false), startMillis(0), firstTimestamp(0),
+          microsPerUnit(1000), rowsEmitted(0), lastLapNumber(0) {}
+
+    const char* name() const override { return "REPLAY"; }
+
+    bool begin(unsigned long nowMillis) override {
+        startMillis = nowMillis;
+        rowsEmitted = 0;
+        ended = false;
+        microsPerUnit = 1000;
+        pendingValid = loadNext();
+        firstTimestamp = pendingValid ? pending.timestampMicros : 0;
+        return pendingValid;
+    }
+
+    // Satu baris berisi semua channel: selalu dikembalikan utuh, mask diabaikan
+    uint32_t read(unsigned long nowMillis, uint32_t channels, SensorReading& out) override {
+        (void)channels;
+        if (!pendingValid) return 0;
+        if (pending.timestampMicros < firstTimestamp) {
+            // Timestamp mundur (sesi baru di file yang sama): mulai ulang patokan waktu
+            firstTimestamp = pending.timestampMicros;
+            startMillis = nowMillis;
+        }
+        if (speed == ReplaySpeed::REAL_TIME &&
+            (pending.timestampMicros - firstTimestamp) * microsPerUnit / 1000 > int64_t(nowMillis - startMillis)) {
+            return 0;  // baris berikutnya belum waktunya
+        }
+
+        out.afr = pending.afr;
+        out.rpm = pending.rpm;
+        out.temp = pending.temp;
+        out.tps = pending.tps;
+        out.map_value = pending.map_value;
+        out.incline = pending.incline;
+        out.stroke = pending.stroke;
+        out.lat = pending.lat;
+        out.lng = pending.lng;
+        out.speed = pending.speed;
+        out.gpsValid = pending.lat != 0.0 || pending.lng != 0.0;
+        out.satellites = out.gpsValid ? 1 : 0;  // jumlah satelit tidak direkam
+        lastLapNumber = pending.lapNumber;
+        rowsEmitted++;
+
+        pendingValid = loadNext();
+        return SENSOR_ALL_CHANNELS;
+    }
+
+    bool finished() const override { return ended && !pendingValid; }
+
+    uint32_t getRowsEmitted() const { return rowsEmitted; }
+    int getLastLapNumber() const { return lastLapNumber; }  // lap di file, bukan lap aktif
+
+private:
+    // Field sama dengan SensorData
+    struct Row {
+        int lapNumber;
+        float afr;
+        float rpm;
+        float temp;
+        float tps;
+        float map_value;
+        double lat;
+        double lng;
+        float speed;
+        float incline;
+        float stroke;
+        int64_t timestampMicros;  // satuan file, lihat microsPerUnit
+        int64_t utcMicros;
+    };
+
+    ITextLineReader& reader;
+    ReplaySpeed speed;
+    Row pending;
+    bool pendingValid;
+    bool ended;
+    unsigned long startMillis;
+    int64_t firstTimestamp;
+    int64_t microsPerUnit;  // 1 = file us, 1000 = file lama ms
+    uint32_t rowsEmitted;
+    int lastLapNumber;
+
+    // Lewati header/komentar/baris rusak sampai baris data berikutnya
+    bool loadNext() {
+        char line[192];
+        while (reader.readLine(line, sizeof(line))) {
+            if (isTelemetryLogMicrosMarker(line)) {
+                microsPerUnit = 1;
+                continue;
+            }
+            if (parseTelemetryLogLine(line, pending)) return true;
+        }
+        ended = true;
+        return false;
+    }
+};
+
+#endif // REPLAY_SENSOR_SOURCE_H
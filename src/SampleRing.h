@@ -0,0 +1,122 @@
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+// SampleRing.h
+// Stream sample tanpa lock: satu producer (SensorManager), banyak consumer.
+// Setiap sample mendapat sequence 1, 2, 3, ... Consumer menyimpan cursor
+// sendiri: recording membaca setiap sample berurutan lewat next(), display
+// atau API cukup latest(). Producer tidak pernah menunggu; consumer yang
+// tertinggal lebih dari N sample melompat ke sample tertua yang masih ada
+// dan jumlah yang terlewat dicatat di cursor (overruns).
+// Setiap slot punya sequence sendiri (0 = sedang ditulis), jadi salinan
+// yang tertimpa di tengah jalan terdeteksi seperti di SeqlockSnapshot.
+// T harus trivially copyable, N pangkat dua.
+
+struct SampleCursor {
+    uint32_t next;       // sequence berikutnya yang akan dibaca
+    uint32_t overruns;   // sample yang terlewat karena consumer tertinggal
+
+    SampleCursor() : next(1), overruns(0) {}
+};
+
+template <typename T, int N>
+class SampleRing {
+public:
+    static_assert(std::is_trivially_copyable<T>::value, "SampleRing butuh T trivially copyable");
+    static_assert(N >= 4 && (N & (N - 1)) == 0, "N harus pangkat dua >= 4");
+    static constexpr int MAX_READ_ATTEMPTS = 4;
+
+    SampleRing() : head(0) {
+        for (int i = 0; i < N; i++) slots[i].sequence.store(0, std::memory_order_relaxed);
+    }
+
+    SampleRing(const SampleRing&) = delete;
+    SampleRing& operator=(const SampleRing&) = delete;
+
+    // Hanya dari satu task (single producer). Mengembalikan sequence sample.
+    uint32_t publish(const T& value) {
+        const uint32_t seq = head.load(std::memory_order_relaxed) + 1;
+        Slot& slot = slots[seq & (N - 1)];
+        slot.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&slot.value, &value, sizeof(T));
+        slot.sequence.store(seq, std::memory_order_release);
+        head.store(seq, std::memory_order_release);
+        return seq;
+    }
+
+    // Jumlah sample sejak start (= sequence terbaru)
+    uint32_t published() const { return head.load(std::memory_order_acquire); }
+
+    // Mulai dari sample berikutnya (abaikan yang sudah ada)
+    void attach(SampleCursor& cursor) const {
+        cursor.next = published() + 1;
+        cursor.overruns = 0;
+    }
+
+    // Sample berikutnya untuk cursor ini, berurutan. False jika belum ada
+    // sample baru (atau producer terus menimpa slot yang dibaca).
+    bool next(SampleCursor& cursor, T& out, uint32_t* sequence = nullptr) const {
+        for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+            const uint32_t newest = head.load(std::memory_order_acquire);
+            if (int32_t(newest - cursor.next) < 0) return false;
+
+            // Slot tertua yang aman: satu slot disisakan untuk publish yang sedang jalan
+            const uint32_t oldest = newest - uint32_t(N - 2);
+            if (int32_t(oldest - cursor.next) > 0) {
+                cursor.overruns += oldest - cursor.next;
+                cursor.next = oldest;
+            }
+
+            if (copySlot(cursor.next, out)) {
+                if (sequence) *sequence = cursor.next;
+                cursor.next++;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Sample terbaru tanpa cursor. False jika belum ada sample.
+    bool latest(T& out, uint32_t* sequence = nullptr) const {
+        for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+            const uint32_t newest = head.load(std::memory_order_acquire);
+            if (newest == 0) return false;
+            if (copySlot(newest, out)) {
+                if (sequence) *sequence = newest;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Sample yang tersedia tapi belum dibaca cursor (maksimal N - 1)
+    uint32_t pending(const SampleCursor& cursor) const {
+        const int32_t behind = int32_t(published() - cursor.next) + 1;
+        return behind > 0 ? uint32_t(behind) : 0;
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        T value;
+    };
+
+    std::atomic<uint32_t> head;
+    Slot slots[N];
+
+    bool copySlot(uint32_t seq, T& out) const {
+        const Slot& slot = slots[seq & (N - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != seq) return false;
+        memcpy(&out, &slot.value, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.sequence.load(std::memory_order_relaxed) == seq;
+    }
+};
+
+#endif // SAMPLE_RING_H
@@ -0,0 +1,114 @@
+#ifndef SENSOR_CALIBRATION_H
+#define SENSOR_CALIBRATION_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// SensorCalibration.h
+// Kalibrasi channel analog sebagai lookup table yang diindeks langsung oleh
+// code ADC 12-bit: konversi per sample = satu baca tabel + satu perkalian
+// skala, tanpa rumus float. Tabel dibangun dari kurva piecewise-linear
+// (breakpoint raw -> nilai fisik), di compile time untuk kurva default
+// (SensorCalibrationData.h) atau saat boot dari file kalibrasi per motor.
+// Tidak bergantung pada Arduino supaya bisa dipakai tools di host.
+
+static constexpr int CAL_ADC_CODES = 4096;
+static constexpr float CAL_VALUE_SCALE = 0.01f;  // satu step tabel = 0.01 satuan fisik
+static constexpr int CAL_MAX_POINTS = 16;
+
+// Urutan sama dengan AdcChannel (AdcSampler.h)
+static constexpr int CAL_CHANNEL_COUNT = 5;
+static constexpr const char* CAL_CHANNEL_NAMES[CAL_CHANNEL_COUNT] = {"AFR", "MAP", "TPS", "INCLINE", "STROKE"};
+
+struct CalPoint {
+    float raw;    // code ADC 0-4095
+    float value;  // satuan fisik
+};
+
+// Breakpoint dengan raw tidak turun. Dua titik dengan raw sama = step.
+// Di luar titik pertama/terakhir nilai ditahan (clamp).
+struct CalCurve {
+    int count;
+    CalPoint points[CAL_MAX_POINTS];
+};
+
+struct CalTable {
+    int16_t steps[CAL_ADC_CODES];
+
+    float lookup(float raw) const {
+        int code = int(raw + 0.5f);
+        if (code < 0) code = 0;
+        if (code > CAL_ADC_CODES - 1) code = CAL_ADC_CODES - 1;
+        return steps[code] * CAL_VALUE_SCALE;
+    }
+};
+
+constexpr float calInterpolate(const CalCurve& curve, float raw) {
+    if (raw <= curve.points[0].raw) return curve.points[0].value;
+    for (int i = 1; i < curve.count; i++) {
+        const CalPoint& a = curve.points[i - 1];
+        const CalPoint& b = curve.points[i];
+        if (raw < b.raw) {
+            return a.value + (b.value - a.value) * (raw - a.raw) / (b.raw - a.raw);
+        }
+    }
+    return curve.points[curve.count - 1].value;
+}
+
+// Nilai di luar range int16 x CAL_VALUE_SCALE (+-327.67) ditolak oleh calCurveValid
+constexpr int16_t calToStep(float value) {
+    const float scaled = value / CAL_VALUE_SCALE;
+    return int16_t(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+}
+
+constexpr void calFillTable(const CalCurve& curve, CalTable& table) {
+    for (int code = 0; code < CAL_ADC_CODES; code++) {
+        table.steps[code] = calToStep(calInterpolate(curve, float(code)));
+    }
+}
+
+constexpr CalTable makeCalTable(const CalCurve& curve) {
+    CalTable table = {};
+    calFillTable(curve, table);
+    return table;
+}
+
+constexpr bool calCurveValid(const CalCurve& curve) {
+    if (curve.count < 2 || curve.count > CAL_MAX_POINTS) return false;
+    const float maxValue = 32767.0f * CAL_VALUE_SCALE;
+    for (int i = 0; i < curve.count; i++) {
+        const CalPoint& p = curve.points[i];
+        if (p.raw < 0.0f || p.raw > CAL_ADC_CODES - 1) return false;
+        if (p.value < -maxValue || p.value > maxValue) return false;
+        if (i > 0 && p.raw < curve.points[i - 1].raw) return false;
+    }
+    return true;
+}
+
+// Satu baris file kalibrasi: "<CHANNEL> <raw> <value>", mis. "AFR 819 11.5".
+// Return 1 = titik valid, 0 = baris kosong/komentar ("#"), -1 = baris rusak.
+inline int parseCalibrationLine(const char* line, int& channel, CalPoint& point) {
+    while (*line == ' ' || *line == '\t') line++;
+    if (*line == '\0' || *line == '#' || *line == '\r' || *line == '\n') return 0;
+
+    size_t nameLength = 0;
+    while (line[nameLength] && line[nameLength] != ' ' && line[nameLength] != '\t') nameLength++;
+    channel = -1;
+    for (int c = 0; c < CAL_CHANNEL_COUNT; c++) {
+        if (strlen(CAL_CHANNEL_NAMES[c]) == nameLength && strncmp(line, CAL_CHANNEL_NAMES[c], nameLength) == 0) {
+            channel = c;
+        }
+    }
+    if (channel < 0) return -1;
+
+    char* end = nullptr;
+    const char* cursor = line + nameLength;
+    point.raw = strtof(cursor, &end);
+    if (end == cursor) return -1;
+    cursor = end;
+    point.value = strtof(cursor, &end);
+    return end != cursor ? 1 : -1;
+}
+
+#endif // SENSOR_CALIBRATION_H
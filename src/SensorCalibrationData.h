@@ -0,0 +1,35 @@
+#ifndef SENSOR_CALIBRATION_DATA_H
+#define SENSOR_CALIBRATION_DATA_H
+
+#include "SensorCalibration.h"
+
+// SensorCalibrationData.h
+// Kurva default (rumus linear lama di SensorManager, skala 5 V / 4095) dan
+// tabelnya yang dibangun compile time ke flash. File kalibrasi per motor
+// (Config::SENSOR_CALIBRATION_FILE) mengganti kurva per channel.
+
+struct SensorCalibrationData {
+    static constexpr CalCurve curves[CAL_CHANNEL_COUNT] = {
+        // AFR: 10 + 2 x V, 0-5 V -> 10-20
+        {2, {{0.0f, 10.0f}, {4095.0f, 20.0f}}},
+        // MAP: (V - 0.5) / 4 x 250 kPa, clamp 0-250
+        {3, {{0.0f, 0.0f}, {409.5f, 0.0f}, {3685.5f, 250.0f}}},
+        // TPS: tertutup di <= 1.2 V, lalu (V - 0.6) / 3.9 x 100 %
+        {4, {{0.0f, 0.0f}, {982.8f, 0.0f}, {982.8f, 15.3846f}, {3685.5f, 100.0f}}},
+        // Incline: -45..45 derajat
+        {2, {{0.0f, -45.0f}, {4095.0f, 45.0f}}},
+        // Stroke: 0-50 mm
+        {2, {{0.0f, 0.0f}, {4095.0f, 50.0f}}},
+    };
+
+    static constexpr CalTable tables[CAL_CHANNEL_COUNT] = {
+        makeCalTable(curves[0]), makeCalTable(curves[1]), makeCalTable(curves[2]),
+        makeCalTable(curves[3]), makeCalTable(curves[4]),
+    };
+
+    static_assert(calCurveValid(curves[0]) && calCurveValid(curves[1]) && calCurveValid(curves[2]) &&
+                      calCurveValid(curves[3]) && calCurveValid(curves[4]),
+                  "Kurva kalibrasi default tidak valid");
+};
+
+#endif // SENSOR_CALIBRATION_DATA_H
@@ -1,261 +1,140 @@
 #include "SensorManager.h"
+#include "ClockService.h"
+#include <esp_timer.h>
 
 SensorManager::SensorManager() 
-    : gps(nullptr), gpsSerial(nullptr), tempSensor(nullptr), oneWire(nullptr),
-      lastSensorUpdate(0), lastGPSUpdate(0) {
+    : source(nullptr), sourceType(SensorSourceType::HARDWARE), hardwareSource(&HardwareSensorSource::getInstance()),
+      simulatedSource(), replaySource(replayReader, ReplaySpeed::REAL_TIME),
+      replayFastSource(replayReader, ReplaySpeed::AS_FAST_AS_POSSIBLE),
+      currentData(), gpsValid(false), satellites(0) {
+    source = hardwareSource;
+    static_assert(sizeof(Config::SENSOR_PRIORITY) == SENSOR_CHANNEL_COUNT, "Satu jadwal per SensorChannel");
+    for (int c = 0; c < SENSOR_CHANNEL_COUNT; c++) {
+        ChannelSchedule schedule = {{Config::SENSOR_PERIOD_IDLE_MS[c], Config::SENSOR_PERIOD_RECORDING_MS[c],
+                                     Config::SENSOR_PERIOD_CRITICAL_MS[c]},
+                                    Config::SENSOR_PRIORITY[c]};
+        scheduler.configure(c, schedule);
+    }
 }
 
 SensorManager::~SensorManager() {
-    delete gps;
-    delete gpsSerial;
-    delete tempSensor;
-    delete oneWire;
+    replayReader.close();
 }
-// Static instance pointer
-SensorManager* SensorManager::instance = nullptr;
 
-// Interrupt handler function
-void IRAM_ATTR SensorManager::rpmInterruptHandler() {
-    if (instance) {
-        instance->rpmPulseCount++;
-    }
+bool SpiffsLineReader::open(const char* path) {
+    close();
+    file = SPIFFS.open(path, "r");
+    return bool(file);
 }
 
-// RPM sensor reading with interrupt
-float SensorManager::readRPMSensor() {
-    unsigned long currentTime = millis();
-    unsigned long timeInterval = currentTime - lastRPMCalculation;
-    
-    // Hitung RPM setiap 1000ms
-    if (timeInterval >= 1000) {
-        // Disable interrupt sementara untuk membaca data
-        noInterrupts();
-        unsigned long pulses = rpmPulseCount;
-        rpmPulseCount = 0;
-        interrupts();
-        
-        // Hitung RPM
-        // Untuk sensor yang memberikan 1 pulse per revolution
-        currentRPM = (pulses * 60.0) / (timeInterval / 1000.0);
-        
-        // Konstrain dan filter
-        currentRPM = constrain(currentRPM, 0, 8000);
-        if (currentRPM < 200) currentRPM = 0;
-        
-        lastRPMCalculation = currentTime;
+void SpiffsLineReader::close() {
+    if (file) {
+        file.close();
     }
-    
-    return currentRPM;
-}
-
-void SensorManager::initialize() {
-    // Initialize analog sensor pins
-    pinMode(Config::PIN_AFR, INPUT);
-    pinMode(Config::PIN_MAP, INPUT);
-    instance = this;
-    rpmPulseCount = 0;
-    lastRPMCalculation = millis();
-    currentRPM = 0.0;
-    
-    pinMode(Config::PIN_RPM, INPUT_PULLUP);
-    attachInterrupt(digitalPinToInterrupt(Config::PIN_RPM), rpmInterruptHandler, FALLING);
-    pinMode(Config::PIN_TPS, INPUT);
-    pinMode(Config::PIN_INCLINE, INPUT);
-    pinMode(Config::PIN_STROKE, INPUT);
-
-    
-    // Initialize GPS
-    gps = new TinyGPSPlus();
-    gpsSerial = new HardwareSerial(2);
-    gpsSerial->begin(9600, SERIAL_8N1, Config::GPS_RX, Config::GPS_TX);
-    
-    // Initialize temperature sensor
-    oneWire = new OneWire(Config::PIN_TEMP);
-    tempSensor = new DallasTemperature(oneWire);
-    tempSensor->begin();
-    
-    Serial.println("=== Sensors Initialized ===");
-    Serial.printf("AFR Sensor: Pin %d\n", Config::PIN_AFR);
-    Serial.printf("MAP Sensor: Pin %d\n", Config::PIN_MAP);
-    Serial.printf("TPS Sensor: Pin %d\n", Config::PIN_TPS);
-    Serial.printf("Incline Sensor: Pin %d\n", Config::PIN_INCLINE);
-    Serial.printf("Stroke Sensor: Pin %d\n", Config::PIN_STROKE);
-    Serial.printf("Temperature Sensor: Pin %d (DS18B20)\n", Config::PIN_TEMP);
-    Serial.printf("GPS: RX=%d, TX=%d\n", Config::GPS_RX, Config::GPS_TX);
 }
 
-void SensorManager::update() {
-    unsigned long currentTime = millis();
-    
-    if (currentTime - lastSensorUpdate >= Config::SENSOR_UPDATE_INTERVAL) {
-        // Read all sensors
-        // currentData.afr = readAFRSensor(); // real pembacaan
-        currentData.afr = random(11.20, 12.00); // For testing  ();
-        currentData.rpm = readRPMSensor();
-        currentData.temp = readTemperatureSensor();
-        currentData.tps = readTPSSensor();
-        currentData.map_value = readMAPSensor();
-        currentData.incline = 0.0;
-        currentData.stroke = 0.0;
-        currentData.timestamp = currentTime;
-        
-        // Update GPS data if available
-        if (gps->location.isValid()) {
-            currentData.lat = gps->location.lat();
-            currentData.lng = gps->location.lng();
-            currentData.speed = gps->speed.kmph();
-        } else {
-            currentData.speed = 0.0;
-        }
-        
-        lastSensorUpdate = currentTime;
+bool SpiffsLineReader::readLine(char* buffer, size_t size) {
+    if (!file || !file.available()) {
+        return false;
     }
+    size_t length = file.readBytesUntil('\n', buffer, size - 1);
+    buffer[length] = '\0';
+    return true;
 }
 
-void SensorManager::updateGPS() {
-    unsigned long currentTime = millis();
-    
-    if (currentTime - lastGPSUpdate >= Config::GPS_UPDATE_INTERVAL) {
-        while (gpsSerial->available()) {
-            gps->encode(gpsSerial->read());
+void SensorManager::initialize() {
+    hardwareSource->begin(millis());
+    sourceType = SensorSourceType::HARDWARE;
+    source = hardwareSource;
+}
+
+bool SensorManager::setSource(SensorSourceType type, bool fastReplay) {
+    ISensorSource *next = hardwareSource;
+    if (type == SensorSourceType::SIMULATED) {
+        next = &simulatedSource;
+    } else if (type == SensorSourceType::REPLAY) {
+        if (!replayReader.open(Config::SENSOR_REPLAY_FILE)) {
+            Serial.printf("ERROR: Cannot open replay file %s\n", Config::SENSOR_REPLAY_FILE);
+            return false;
         }
-        lastGPSUpdate = currentTime;
+        next = fastReplay ? static_cast<ISensorSource *>(&replayFastSource) : &replaySource;
     }
-}
 
-float SensorManager::readAFRSensor() {
-    int rawValue = analogRead(Config::PIN_AFR);
-    float voltage = rawValue * (5.0 / 4095.0);
-    float afr = 10.0 + (voltage * 2.0);
-    
-    if (afr < 10.0) afr = 10.0;
-    if (afr > 20.0) afr = 20.0;
-    
-    return afr;
-}
+    if (!next->begin(millis())) {
+        Serial.printf("ERROR: Sensor source %s has no data\n", next->name());
+        replayReader.close();
+        return false;
+    }
+    if (type != SensorSourceType::REPLAY) {
+        replayReader.close();
+    }
 
-float SensorManager::readMAPSensor() {
-    int rawValue = analogRead(Config::PIN_MAP);
-    float voltage = rawValue * (5.0 / 4095.0);
-    float pressure = ((voltage - 0.5) / 4.0) * 250.0;
-    
-    if (pressure < 0) pressure = 0;
-    if (pressure > 250) pressure = 250;
-    
-    return pressure;
+    source = next;
+    sourceType = type;
+    scheduler.restart();
+    Serial.printf("Sensor source: %s\n", source->name());
+    return true;
 }
 
-// float SensorManager::readTPSSensor() { // ini yang belum di pulldown
-//     // Baca nilai ADC mentah
-//     int rawValue = analogRead(Config::PIN_TPS);
-    
-//     // Konversi ke persentase (0-100% berdasarkan ADC 12-bit)
-//     float percentage = (rawValue / 4095.0) * 100.0;
-    
-//     // Konstrain nilai dalam range yang valid
-//     percentage = constrain(percentage, 0, 100);
-    
-//     // Mapping dari range aktual (16-100) ke range yang diinginkan (0-100)
-//     if (percentage >= 16.0) {
-//         // Gunakan map() dengan floating point
-//         percentage = ((percentage - 16.0) / (100.0 - 16.0)) * 100.0;
-//     } else {
-//         // Jika pembacaan di bawah 16%, anggap sebagai 0%
-//         percentage = 0.0;
-//     }
-    
-//     // Konstrain hasil akhir
-//     percentage = constrain(percentage, 0, 100);
-    
-//     return percentage;
-// }
-float SensorManager::readTPSSensor() {
-    // Variabel untuk smoothing dan filtering
-    static float previousReading = 0.0;
-    static unsigned long lastReadTime = 0;
-    static float smoothedValue = 0.0;
-    
-    // Multi-sampling untuk mengurangi noise
-    const int numSamples = 10;
-    unsigned long totalReading = 0;
-    
-    // Ambil multiple samples untuk averaging
-    for (int i = 0; i < numSamples; i++) {
-        totalReading += analogRead(Config::PIN_TPS);
-        delayMicroseconds(100); // Small delay between readings
-    }
-    
-    // Hitung rata-rata ADC value
-    float avgRawValue = totalReading / (float)numSamples;
-    
-    // Konversi ke voltage (ESP32 ADC 12-bit, 3.3V reference)
-    float voltage = avgRawValue * (5.0 / 4095.0);
-    
-    // Kalibrasi berdasarkan karakteristik TPS
-    // TPS standar: Idle = 0.6-0.9V, WOT = 3.5-4.7V
-    // Mapping voltage ke percentage
-    float percentage;
-    
-    if (voltage <= 1.2) {
-        // Throttle tertutup penuh
-        percentage = 0.0;
-    } else {
-        // Linear mapping dari voltage ke percentage
-        percentage = ((voltage - 0.6) / (4.5 - 0.6)) * 100.0;
-    }
-    
-    // Konstrain hasil dalam range 0-100%
-    percentage = constrain(percentage, 0.0, 100.0);
-    
-    // Terapkan low-pass filter untuk smoothing
+void SensorManager::update() {
     unsigned long currentTime = millis();
-    if (currentTime - lastReadTime > 20) { // Update setiap 50ms
-        float alpha = 0.2; // Smoothing factor (0-1, semakin kecil semakin smooth)
-        smoothedValue = (alpha * percentage) + ((1 - alpha) * smoothedValue);
-        lastReadTime = currentTime;
-    }
-    
-    // Dead zone untuk mengurangi jitter di idle
-    if (smoothedValue < 2.0) {
-        smoothedValue = 0.0;
-    }
     
-    return smoothedValue;
-}
+    // Setiap loop: langkah non-blocking sumber (state machine DS18B20 di hardware)
+    source->poll(currentTime);
 
+    const uint32_t dueChannels = scheduler.due(currentTime, Config::SENSOR_CHANNELS_PER_TICK);
+    if (dueChannels == 0) {
+        return;
+    }
 
-float SensorManager::readInclineSensor() {
-    int rawValue = analogRead(Config::PIN_INCLINE);
-    float angle = ((rawValue / 4095.0) * 90.0) - 45.0;
-    
-    if (angle < -45.0) angle = -45.0;
-    if (angle > 45.0) angle = 45.0;
-    
-    return angle;
-}
-
-float SensorManager::readStrokeSensor() {
-    int rawValue = analogRead(Config::PIN_STROKE);
-    float stroke = (rawValue / 4095.0) * 50.0;
-    
-    if (stroke < 0) stroke = 0;
-    if (stroke > 50) stroke = 50;
-    
-    return stroke;
-}
+    // Hanya channel yang diisi sumber yang diperbarui; sisanya tetap nilai terakhir.
+    // Timestamp 64-bit us diambil saat akuisisi, bukan saat sample ditulis/dikirim.
+    const int64_t acquiredMicros = esp_timer_get_time();
+    SensorReading reading;
+    const uint32_t filled = source->read(currentTime, dueChannels, reading);
+    if (filled == 0) {
+        if (source->finished()) {
+            Serial.printf("Sensor source %s finished - back to hardware\n", source->name());
+            setSource(SensorSourceType::HARDWARE);
+        }
+        return;
+    }
 
-float SensorManager::readTemperatureSensor() {
-    tempSensor->requestTemperatures();
-    float temp = tempSensor->getTempCByIndex(0);
-    
-    if (isnan(temp) || temp == DEVICE_DISCONNECTED_C) {
-        Serial.println("Warning: Temperature sensor error, using default value");
-        temp = 85.0;
+    if (filled & sensorChannelBit(SensorChannel::AFR)) currentData.afr = reading.afr;
+    if (filled & sensorChannelBit(SensorChannel::RPM)) currentData.rpm = reading.rpm;
+    if (filled & sensorChannelBit(SensorChannel::TEMP)) currentData.temp = reading.temp;
+    if (filled & sensorChannelBit(SensorChannel::TPS)) currentData.tps = reading.tps;
+    if (filled & sensorChannelBit(SensorChannel::MAP)) currentData.map_value = reading.map_value;
+    if (filled & sensorChannelBit(SensorChannel::INCLINE)) currentData.incline = reading.incline;
+    if (filled & sensorChannelBit(SensorChannel::STROKE)) currentData.stroke = reading.stroke;
+    if (filled & sensorChannelBit(SensorChannel::GPS)) {
+        // Posisi terakhir dipertahankan saat fix hilang
+        gpsValid = reading.gpsValid;
+        satellites = reading.satellites;
+        if (gpsValid) {
+            currentData.lat = reading.lat;
+            currentData.lng = reading.lng;
+            currentData.speed = reading.speed;
+        } else {
+            currentData.speed = 0.0;
+        }
+    }
+    currentData.channels = filled;
+    currentData.timestampMicros = acquiredMicros;
+    currentData.utcMicros = ClockService::getInstance().toUtcMicros(acquiredMicros);
+    samples.publish(currentData);
+}
+
+void SensorManager::printSchedule() const {
+    static const char *const channelNames[SENSOR_CHANNEL_COUNT] = {"AFR", "RPM", "TEMP", "TPS",
+                                                                    "MAP", "INCLINE", "STROKE", "GPS"};
+    static const char *const modeNames[SCHEDULE_MODE_COUNT] = {"IDLE", "RECORDING", "CRITICAL"};
+    Serial.printf("Schedule mode: %s\n", modeNames[int(scheduler.getMode())]);
+    for (int c = 0; c < SENSOR_CHANNEL_COUNT; c++) {
+        Serial.printf("  %-8s every %4u ms, priority %u, reads %u, deferred %u\n", channelNames[c],
+                      scheduler.getPeriod(c), scheduler.getPriority(c), (unsigned)scheduler.getRuns(c),
+                      (unsigned)scheduler.getDeferred(c));
     }
-    
-    if (temp < -40.0) temp = -40.0;
-    if (temp > 150.0) temp = 150.0;
-    return temp;
 }
 
 float SensorManager::estimateRPM() {
@@ -272,25 +151,20 @@ float SensorManager::estimateRPM() {
     return estimatedRPM;
 }
 
-
-bool SensorManager::isGPSValid() const {
-    return gps->location.isValid();
-}
-
 double SensorManager::getLatitude() const {
-    return gps->location.lat();
+    return currentData.lat;
 }
 
 double SensorManager::getLongitude() const {
-    return gps->location.lng();
+    return currentData.lng;
 }
 
 float SensorManager::getSpeed() const {
-    return gps->speed.kmph();
+    return currentData.speed;
 }
 
 int SensorManager::getSatelliteCount() const {
-    return gps->satellites.value();
+    return satellites;
 }
 
 void SensorManager::logSensorData() {
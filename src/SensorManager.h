@@ -2,32 +2,49 @@
 #define SENSOR_MANAGER_H
 
 #include "DataStructures.h"
+#include "SampleRing.h"
+#include "SensorSource.h"
+#include "ChannelScheduler.h"
+#include "HardwareSensorSource.h"
+#include "SimulatedSensorSource.h"
+#include "ReplaySensorSource.h"
+
+enum class SensorSourceType {
+    HARDWARE = 0,
+    SIMULATED = 1,
+    REPLAY = 2
+};
+
+// Baris file rekaman dari SPIFFS untuk ReplaySensorSource
+class SpiffsLineReader : public ITextLineReader {
+private:
+    File file;
+
+public:
+    bool open(const char* path);
+    void close();
+    bool readLine(char* buffer, size_t size) override;
+};
 
 class SensorManager
 {
 private:
-    TinyGPSPlus *gps;
-    HardwareSerial *gpsSerial;
-    DallasTemperature *tempSensor;
-    OneWire *oneWire;
-    // RPM sensor variables
-    static SensorManager* instance;
-    volatile unsigned long rpmPulseCount;
-    unsigned long lastRPMCalculation;
-    float currentRPM;
+    // Sumber aktif; hardware selalu tersedia sebagai fallback
+    ISensorSource *source;
+    SensorSourceType sourceType;
+    HardwareSensorSource *hardwareSource;
+    SimulatedSensorSource simulatedSource;
+    SpiffsLineReader replayReader;
+    ReplaySensorSource replaySource;
+    ReplaySensorSource replayFastSource;
 
     SensorData currentData;
-    unsigned long lastSensorUpdate;
-    unsigned long lastGPSUpdate;
-    unsigned long lastTime;
-   static void IRAM_ATTR rpmInterruptHandler();
-    float readRPMSensor();
-    // Private sensor reading methods
-    float readAFRSensor();
-    float readMAPSensor();
-    float readTPSSensor();
-    float readInclineSensor();
-    float readStrokeSensor();
+    // Setiap sample baru dipublish di sini; consumer membaca dengan cursor sendiri
+    SampleRing<SensorData, Config::SENSOR_SAMPLE_RING_SIZE> samples;
+    // Periode dan prioritas per channel, dipercepat saat recording / critical
+    ChannelScheduler<SENSOR_CHANNEL_COUNT> scheduler;
+    bool gpsValid;
+    uint8_t satellites;
     float estimateRPM();
 
 public:
@@ -35,12 +52,26 @@ public:
     ~SensorManager();
     void initialize();
     void update();
-    void updateGPS();
-    float readTemperatureSensor();
+
+    // Ganti sumber data sensor saat runtime (SENSOR_SOURCE)
+    bool setSource(SensorSourceType type, bool fastReplay = false);
+    SensorSourceType getSourceType() const { return sourceType; }
+    const char *getSourceName() const { return source->name(); }
+
+    // Mode jadwal akuisisi (RacingTelemetry: recording / klasifikasi critical)
+    void setScheduleMode(ScheduleMode mode) { scheduler.setMode(mode); }
+    ScheduleMode getScheduleMode() const { return scheduler.getMode(); }
+    void printSchedule() const;
+
+    // Sample stream: next() berurutan per consumer (recording), latest() untuk yang cukup nilai terbaru
+    void attachSampleCursor(SampleCursor &cursor) const { samples.attach(cursor); }
+    bool readNextSample(SampleCursor &cursor, SensorData &data) const { return samples.next(cursor, data); }
+    bool getLatestSample(SensorData &data) const { return samples.latest(data); }
+    uint32_t getSampleCount() const { return samples.published(); }
 
     // Getters
     const SensorData &getCurrentData() const { return currentData; }
-    bool isGPSValid() const;
+    bool isGPSValid() const { return gpsValid; }
     double getLatitude() const;
     double getLongitude() const;
     float getSpeed() const;
@@ -0,0 +1,70 @@
+#ifndef SENSOR_SOURCE_H
+#define SENSOR_SOURCE_H
+
+#include <stdint.h>
+
+// SensorSource.h
+// Sumber data sensor yang bisa diganti: hardware (pin, DS18B20, GPS),
+// simulator lap deterministik, atau replay file rekaman. SensorManager
+// hanya memanggil poll() setiap loop dan read() untuk channel yang jatuh tempo,
+// jadi pipeline di atasnya (klasifikasi, recording, display) sama untuk
+// semua sumber. Tidak bergantung pada Arduino supaya simulator dan replay
+// juga jalan di host (tools/sensor_pipeline.cpp).
+
+// Channel yang dijadwalkan terpisah (ChannelScheduler.h); bit ke-n = channel n
+enum class SensorChannel {
+    AFR = 0,
+    RPM,
+    TEMP,
+    TPS,
+    MAP,
+    INCLINE,
+    STROKE,
+    GPS,  // gpsValid, lat, lng, speed, satellites
+    COUNT
+};
+
+static constexpr int SENSOR_CHANNEL_COUNT = int(SensorChannel::COUNT);
+static constexpr uint32_t SENSOR_ALL_CHANNELS = (1u << SENSOR_CHANNEL_COUNT) - 1;
+
+inline uint32_t sensorChannelBit(SensorChannel channel) { return 1u << int(channel); }
+
+// Satu pembacaan semua channel. lapNumber dan timestampMicros diisi SensorManager.
+struct SensorReading {
+    float afr;
+    float rpm;
+    float temp;
+    float tps;
+    float map_value;
+    float incline;
+    float stroke;
+    bool gpsValid;
+    double lat;
+    double lng;
+    float speed;
+    uint8_t satellites;
+};
+
+class ISensorSource {
+public:
+    virtual ~ISensorSource() {}
+
+    virtual const char* name() const = 0;
+
+    // Dipanggil sekali sebelum read(); false jika sumber tidak bisa dipakai
+    virtual bool begin(unsigned long nowMillis) = 0;
+
+    // Langkah non-blocking setiap loop (mis. state machine DS18B20). Opsional.
+    virtual void poll(unsigned long nowMillis) { (void)nowMillis; }
+
+    // Isi out dengan pembacaan terbaru untuk channel di mask `channels` (bit
+    // SensorChannel yang jatuh tempo). Sumber boleh mengisi lebih banyak
+    // channel; return = mask channel yang benar-benar diisi, 0 jika belum
+    // ada sample baru (replay 1x menunggu timestamp) atau sumber sudah habis.
+    virtual uint32_t read(unsigned long nowMillis, uint32_t channels, SensorReading& out) = 0;
+
+    // true jika sumber tidak akan menghasilkan data lagi (akhir file replay)
+    virtual bool finished() const { return false; }
+};
+
+#endif // SENSOR_SOURCE_H
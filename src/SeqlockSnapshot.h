@@ -0,0 +1,61 @@
+#ifndef SEQLOCK_SNAPSHOT_H
+#define SEQLOCK_SNAPSHOT_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+// SeqlockSnapshot.h
+// Satu slot "nilai terbaru" antar core tanpa lock: satu writer menimpa,
+// reader menyalin dan mengulang jika sequence berubah di tengah salinan.
+// Writer tidak pernah menunggu reader. Reader tidak spin tanpa batas:
+// setelah MAX_READ_ATTEMPTS gagal (writer ter-preempt di tengah publish),
+// read() mengembalikan false dan caller cukup mencoba lagi nanti.
+// T harus trivially copyable (mis. SensorData).
+
+template <typename T>
+class SeqlockSnapshot {
+public:
+    static_assert(std::is_trivially_copyable<T>::value, "SeqlockSnapshot butuh T trivially copyable");
+    static constexpr int MAX_READ_ATTEMPTS = 4;
+
+    SeqlockSnapshot() : sequence(0), value() {}
+
+    SeqlockSnapshot(const SeqlockSnapshot&) = delete;
+    SeqlockSnapshot& operator=(const SeqlockSnapshot&) = delete;
+
+    // Hanya boleh dipanggil dari satu task (single writer)
+    void publish(const T& next) {
+        const uint32_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);  // ganjil = sedang ditulis
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&value, &next, sizeof(T));
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    // False jika belum pernah publish atau salinan tidak konsisten.
+    // version (opsional) = jumlah publish sampai snapshot ini.
+    bool read(T& out, uint32_t* version = nullptr) const {
+        for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+            const uint32_t before = sequence.load(std::memory_order_acquire);
+            if (before == 0) return false;
+            if (before & 1) continue;
+            memcpy(&out, &value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before) {
+                if (version) *version = before / 2;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t version() const { return sequence.load(std::memory_order_acquire) / 2; }
+
+private:
+    std::atomic<uint32_t> sequence;
+    T value;
+};
+
+#endif // SEQLOCK_SNAPSHOT_H
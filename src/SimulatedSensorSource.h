@@ -0,0 +1,120 @@
+#ifndef SIMULATED_SENSOR_SOURCE_H
+#define SIMULATED_SENSOR_SOURCE_H
+
+#include <math.h>
+#include "SensorSource.h"
+
+// SimulatedSensorSource.h
+// Simulator lap parametrik yang deterministik: sinyal hanya fungsi dari
+// waktu sejak begin() dan seed noise, jadi dua run dengan urutan nowMillis
+// yang sama menghasilkan data yang identik (regression test).
+//
+// Model: mesin idle dingin selama startupSeconds (TPS 0, suhu naik), lalu
+// lap di lintasan lingkaran dengan `corners` tikungan per lap. Kecepatan
+// turun di tikungan dan naik di lurusan; TPS mengikuti akselerasi, RPM
+// mengikuti kecepatan per gigi, MAP dan AFR mengikuti TPS. faultLap > 0
+// membuat campuran terlalu kaya (AFR ~11.5) selama lap itu.
+
+struct SimLapProfile {
+    float lapSeconds;
+    float lapLengthMeters;
+    int corners;
+    float startupSeconds;
+    float ambientTemp;
+    float operatingTemp;
+    float warmupTau;        // detik
+    float gpsFixSeconds;    // GPS valid setelah ini
+    double startLat;
+    double startLng;
+    int faultLap;           // lap dengan AFR kaya, <= 0 = tidak ada
+    uint32_t noiseSeed;
+};
+
+static constexpr SimLapProfile SIM_DEFAULT_PROFILE = {
+    90.0f, 2000.0f, 4, 20.0f, 30.0f, 88.0f, 40.0f, 5.0f, -6.5355, 106.8566, 3, 0x5EED5EEDu};
+
+class SimulatedSensorSource : public ISensorSource {
+public:
+    explicit SimulatedSensorSource(const SimLapProfile& profile = SIM_DEFAULT_PROFILE)
+        : profile(profile), startMillis(0), noise(profile.noiseSeed) {}
+
+    const char* name() const override { return "SIM"; }
+
+    bool begin(unsigned long nowMillis) override {
+        startMillis = nowMillis;
+        noise = profile.noiseSeed;
+        return true;
+    }
+
+    // Semua channel selalu dihitung (murah), jadi mask diabaikan
+    uint32_t read(unsigned long nowMillis, uint32_t channels, SensorReading& out) override {
+        (void)channels;
+        const float t = (nowMillis - startMillis) / 1000.0f;
+        const float warmup = 1.0f - expf(-t / profile.warmupTau);
+        out.temp = profile.ambientTemp + (profile.operatingTemp - profile.ambientTemp) * warmup + jitter(0.2f);
+        out.incline = 0.0f;
+        out.stroke = 0.0f;
+        out.satellites = t >= profile.gpsFixSeconds ? 9 : 0;
+        out.gpsValid = out.satellites > 0;
+
+        if (t < profile.startupSeconds) {
+            // Idle di pit: throttle tertutup
+            out.tps = 0.0f;
+            out.rpm = 1100.0f + jitter(40.0f);
+            out.map_value = 70.0f + jitter(1.0f);
+            out.afr = 14.2f + jitter(0.1f);
+            out.speed = 0.0f;
+            setPosition(0.0f, out);
+            return SENSOR_ALL_CHANNELS;
+        }
+
+        // Sudut di lintasan: theta(t) = w t + A sin(k w t), A k = 0.5
+        const float pi2 = 6.2831853f;
+        const float lapTime = t - profile.startupSeconds;
+        const float w = pi2 / profile.lapSeconds;
+        const float k = float(profile.corners);
+        const float theta = w * lapTime + (0.5f / k) * sinf(k * w * lapTime);
+        const float radius = profile.lapLengthMeters / pi2;
+
+        const float speedMs = radius * w * (1.0f + 0.5f * cosf(k * w * lapTime));
+        const float accel = -radius * w * w * 0.5f * k * sinf(k * w * lapTime);  // m/s^2
+        out.speed = speedMs * 3.6f;
+
+        // Throttle dari akselerasi (tidak pernah tertutup penuh saat jalan),
+        // RPM per gigi (ganti gigi tiap 25 km/h), rentang sama dengan training set
+        out.tps = clampf(50.0f + accel * 15.0f + jitter(1.0f), 3.0f, 100.0f);
+        const float gearPosition = out.speed / 25.0f;
+        out.rpm = 2400.0f + 1400.0f * (gearPosition - floorf(gearPosition)) + jitter(50.0f);
+        out.map_value = 90.0f + 0.55f * out.tps + jitter(0.5f);
+
+        const int lap = 1 + int(lapTime / profile.lapSeconds);
+        out.afr = (profile.faultLap > 0 && lap == profile.faultLap) ? 11.5f + jitter(0.1f)
+                                                                     : 14.7f - 1.6f * out.tps / 100.0f + jitter(0.1f);
+        setPosition(theta, out);
+        return SENSOR_ALL_CHANNELS;
+    }
+
+private:
+    SimLapProfile profile;
+    unsigned long startMillis;
+    uint32_t noise;
+
+    // Noise uniform [-amplitude, amplitude] dari LCG, deterministik per seed
+    float jitter(float amplitude) {
+        noise = noise * 1664525u + 1013904223u;
+        return ((noise >> 8) / 8388608.0f - 1.0f) * amplitude;
+    }
+
+    static float clampf(float value, float lo, float hi) { return value < lo ? lo : (value > hi ? hi : value); }
+
+    void setPosition(float theta, SensorReading& out) const {
+        // Start/finish di (startLat, startLng), lingkaran ke utara
+        const double radius = profile.lapLengthMeters / 6.283185307179586;
+        const double metersPerDegLat = 111320.0;
+        const double metersPerDegLng = 111320.0 * cos(profile.startLat * 0.017453292519943295);
+        out.lat = profile.startLat + radius * (1.0 - cos(theta)) / metersPerDegLat;
+        out.lng = profile.startLng + radius * sin(theta) / metersPerDegLng;
+    }
+};
+
+#endif // SIMULATED_SENSOR_SOURCE_H
@@ -0,0 +1,64 @@
+#ifndef TELEMETRY_LOG_H
+#define TELEMETRY_LOG_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// TelemetryLog.h
+// Parser satu baris data dari file rekaman (/telemetry_data.txt, ditulis
+// RecordingManager::appendDataToFile):
+//   lapNumber,afr,rpm,temp,tps,map,lat,lng,speed,incline,stroke,timestamp[,utc]
+// utc (us sejak epoch, 0 = jam GPS belum sinkron) opsional, file lama
+// tanpa kolom ini dibaca dengan utc 0. Baris header dan komentar ("#") ditolak. Row = SensorData di firmware
+// atau struct dengan field yang sama di host tool.
+// Timestamp dalam mikrodetik jika header berisi TELEMETRY_LOG_MICROS_MARKER,
+// file lama tanpa marker memakai milidetik.
+
+static constexpr const char* TELEMETRY_LOG_MICROS_MARKER = "# Timestamp unit: us";
+
+template <typename Row>
+inline bool parseTelemetryLogLine(const char* line, Row& row) {
+    double values[12];
+    const char* cursor = line;
+    for (int i = 0; i < 12; i++) {
+        char* end = nullptr;
+        values[i] = strtod(cursor, &end);
+        if (end == cursor) return false;
+        if (i < 11) {
+            if (*end != ',') return false;
+            cursor = end + 1;
+        } else {
+            cursor = end;
+        }
+    }
+
+    double utc = 0.0;
+    if (*cursor == ',') {
+        char* end = nullptr;
+        utc = strtod(cursor + 1, &end);
+        if (end == cursor + 1) return false;
+    }
+
+    row.lapNumber = int(values[0]);
+    row.afr = float(values[1]);
+    row.rpm = float(values[2]);
+    row.temp = float(values[3]);
+    row.tps = float(values[4]);
+    row.map_value = float(values[5]);
+    row.lat = values[6];
+    row.lng = values[7];
+    row.speed = float(values[8]);
+    row.incline = float(values[9]);
+    row.stroke = float(values[10]);
+    row.timestampMicros = int64_t(values[11]);  // double: presisi penuh sampai 2^53
+    row.utcMicros = int64_t(utc);
+    return true;
+}
+
+// true untuk baris header yang menandai timestamp mikrodetik
+inline bool isTelemetryLogMicrosMarker(const char* line) {
+    return strncmp(line, TELEMETRY_LOG_MICROS_MARKER, strlen(TELEMETRY_LOG_MICROS_MARKER)) == 0;
+}
+
+#endif // TELEMETRY_LOG_H
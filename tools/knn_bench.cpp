@@ -0,0 +1,401 @@
+// knn_bench.cpp
+// Host benchmark untuk jalur klasifikasi KNN (tanpa Arduino).
+//
+// Build & run:
+//   g++ -O2 -std=c++17 -Isrc tools/knn_bench.cpp -o knn_bench && ./knn_bench
+//
+// "legacy" mereplikasi runKNNClassification lama: setiap panggilan menyalin
+// dan menormalisasi ke-200 baris training. "prenormalized" memakai matrix
+// z-scored dari KnnModel.h sehingga hanya query yang dinormalisasi.
+// "topk" memakai squared distance, partial-distance early exit, dan heap K
+// kandidat di atas matrix row-major (AoS). "soa" adalah jalur firmware saat
+// ini: store column-major dengan block distance kernel. "quant" adalah
+// engine int16 Q6.9 dengan integer squared distance. "kdtree" adalah
+// exact search lewat KD-tree. "engine" adalah scan SoA lewat
+// KnnEngine<N, D, K, C> (instansiasi yang sama dengan KNNClassifier). "grid" adalah lookup decision grid
+// (approximate, jadi kolom agree < 100% untuk query uniform adalah wajar).
+//
+// Bagian kedua membandingkan scan AoS, SoA dan KD-tree pada training set
+// sintetis 200 sampai 200.000 baris (baris asli + jitter kecil).
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+
+#include "KnnModel.h"
+#include "KnnTopK.h"
+#include "KnnFeatureStore.h"
+#include "KnnKdTree.h"
+#include "KnnDecisionGridData.h"
+
+namespace {
+
+constexpr int NUM_FEATURES = KnnModel::NUM_FEATURES;
+constexpr int NUM_SAMPLES = KnnModel::NUM_SAMPLES;
+constexpr int NUM_QUERIES = 1024;
+constexpr int ITERATIONS = 200;
+
+struct Query {
+    float features[NUM_FEATURES];
+};
+
+// Salinan row-major dari training set ter-normalisasi (layout sebelum SoA)
+float trainingRows[NUM_SAMPLES][NUM_FEATURES];
+
+void buildTrainingRows() {
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            trainingRows[i][f] = KnnModel::trainingSet.columns[f][i];
+        }
+    }
+}
+
+// Scan AoS (sebelum SoA): linear atas matrix row-major ter-normalisasi. Kandidat dibuang begitu
+// partial sum melewati jarak K-terjauh saat ini.
+template <int K, int D>
+inline void knnScanRows(const float* query, const float (*features)[D], const uint8_t* labels,
+                        uint32_t count, KnnTopK<K>& topK) {
+    for (uint32_t i = 0; i < count; i++) {
+        const float bound = topK.worstDistance();
+        float dist = 0;
+        int f = 0;
+        KNN_UNROLL
+        for (; f < D; f++) {
+            float diff = query[f] - features[i][f];
+            dist += diff * diff;
+            if (dist > bound) break;
+        }
+        if (f == D && topK.accepts(dist, i)) {
+            topK.offer(dist, i, labels[i]);
+        }
+    }
+}
+
+struct Candidate {
+    float distance;
+    int classification;
+};
+
+// Deterministic input set yang mencakup seluruh range sensor
+void generateQueries(Query* queries, int count) {
+    static const float lo[NUM_FEATURES] = {10.0f, 0.0f, -40.0f, 0.0f, 0.0f};
+    static const float hi[NUM_FEATURES] = {20.0f, 8000.0f, 150.0f, 100.0f, 250.0f};
+    uint32_t state = 0x12345678u;
+    for (int q = 0; q < count; q++) {
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            state = state * 1664525u + 1013904223u;
+            float unit = (state >> 8) / 16777216.0f;
+            queries[q].features[f] = lo[f] + unit * (hi[f] - lo[f]);
+        }
+    }
+}
+
+float euclidean(const float* a, const float* b) {
+    float dist = 0;
+    for (int i = 0; i < NUM_FEATURES; i++) {
+        float diff = a[i] - b[i];
+        dist += diff * diff;
+    }
+    return std::sqrt(dist);
+}
+
+int voteNearest(Candidate* distances, int size) {
+    for (int i = 0; i < 3; i++) {
+        int minIdx = i;
+        for (int j = i + 1; j < size; j++) {
+            if (distances[j].distance < distances[minIdx].distance) {
+                minIdx = j;
+            }
+        }
+        Candidate temp = distances[i];
+        distances[i] = distances[minIdx];
+        distances[minIdx] = temp;
+    }
+
+    int votes[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        votes[distances[i].classification]++;
+    }
+    int maxVotes = 0;
+    int result = 0;
+    for (int i = 0; i < 4; i++) {
+        if (votes[i] > maxVotes) {
+            maxVotes = votes[i];
+            result = i;
+        }
+    }
+    if (maxVotes == 1) {
+        result = distances[0].classification;
+    }
+    return result;
+}
+
+void normalizeLegacy(float* features) {
+    for (int i = 0; i < NUM_FEATURES; i++) {
+        features[i] = (features[i] - KnnTrainingData::featureMeans[i]) / KnnTrainingData::featureStds[i];
+    }
+}
+
+int classifyLegacy(const Query& query) {
+    float features[NUM_FEATURES];
+    for (int f = 0; f < NUM_FEATURES; f++) features[f] = query.features[f];
+    normalizeLegacy(features);
+
+    Candidate distances[NUM_SAMPLES];
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        const KnnRawSample& row = KnnPrototypeData::samples[i];
+        float trainFeatures[NUM_FEATURES] = {row.afr, row.rpm, row.temp, row.tps, row.map_value};
+        normalizeLegacy(trainFeatures);
+        distances[i].distance = euclidean(features, trainFeatures);
+        distances[i].classification = row.classification;
+    }
+    return voteNearest(distances, NUM_SAMPLES);
+}
+
+int classifyPrenormalized(const Query& query) {
+    float features[NUM_FEATURES];
+    for (int f = 0; f < NUM_FEATURES; f++) features[f] = query.features[f];
+    KnnModel::normalizeQuery(features);
+
+    Candidate distances[NUM_SAMPLES];
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        distances[i].distance = euclidean(features, trainingRows[i]);
+        distances[i].classification = KnnModel::trainingSet.labels[i];
+    }
+    return voteNearest(distances, NUM_SAMPLES);
+}
+
+int classifyTopK(const Query& query) {
+    float features[NUM_FEATURES];
+    for (int f = 0; f < NUM_FEATURES; f++) features[f] = query.features[f];
+    KnnModel::normalizeQuery(features);
+
+    KnnTopK<3> nearest;
+    knnScanRows(features, trainingRows, KnnModel::trainingSet.labels, NUM_SAMPLES, nearest);
+    return nearest.vote<4>();
+}
+
+int classifySoA(const Query& query) {
+    float features[NUM_FEATURES];
+    for (int f = 0; f < NUM_FEATURES; f++) features[f] = query.features[f];
+    KnnModel::normalizeQuery(features);
+
+    KnnTopK<3> nearest;
+    knnScanColumns(features, KnnModel::trainingStore, nearest);
+    return nearest.vote<4>();
+}
+
+constexpr KnnEngine<NUM_SAMPLES, NUM_FEATURES, 3, 4> engine = KnnModel::makeEngine<3, 4>();
+
+int classifyEngine(const Query& query) {
+    float features[NUM_FEATURES];
+    for (int f = 0; f < NUM_FEATURES; f++) features[f] = query.features[f];
+    engine.normalize(features);
+    return engine.classifyScan(features);
+}
+
+int classifyQuantized(const Query& query) {
+    float features[NUM_FEATURES];
+    for (int f = 0; f < NUM_FEATURES; f++) features[f] = query.features[f];
+    KnnModel::normalizeQuery(features);
+
+    int16_t quantized[NUM_FEATURES];
+    KnnModel::quantizeQuery(features, quantized);
+    KnnTopK<3, uint32_t> nearest;
+    knnScanQuantized(quantized, KnnModel::quantizedStore, nearest);
+    return nearest.vote<4>();
+}
+
+KnnKdTree<NUM_FEATURES> modelTree;
+
+int classifyKdTree(const Query& query) {
+    float features[NUM_FEATURES];
+    for (int f = 0; f < NUM_FEATURES; f++) features[f] = query.features[f];
+    KnnModel::normalizeQuery(features);
+
+    KnnTopK<3> nearest;
+    modelTree.search(features, nearest);
+    return nearest.vote<4>();
+}
+
+int classifyGrid(const Query& query) {
+    return knnGridLookup(KnnDecisionGridData::layout, KnnDecisionGridData::codes, query.features);
+}
+
+struct Backend {
+    const char* name;
+    int (*classify)(const Query&);
+};
+
+double benchmark(const Backend& backend, const Query* queries, int* results) {
+    volatile int sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int it = 0; it < ITERATIONS; it++) {
+        for (int q = 0; q < NUM_QUERIES; q++) {
+            int c = backend.classify(queries[q]);
+            if (it == 0) results[q] = c;
+            sink = sink + c;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return ns / (double(ITERATIONS) * NUM_QUERIES);
+}
+
+// Training set sintetis dalam dua layout dengan isi yang identik
+struct ScaledDataset {
+    std::vector<float> rows;                     // AoS: N x D
+    std::vector<float> columns[NUM_FEATURES];    // SoA: D x N
+    std::vector<uint8_t> labels;
+    KnnFeatureStore<NUM_FEATURES> store;
+};
+
+void buildScaledDataset(ScaledDataset& data, uint32_t count) {
+    data.rows.resize(size_t(count) * NUM_FEATURES);
+    data.labels.resize(count);
+    for (int f = 0; f < NUM_FEATURES; f++) data.columns[f].resize(count);
+
+    uint32_t state = 0x9e3779b9u;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t base = i % NUM_SAMPLES;
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            state = state * 1664525u + 1013904223u;
+            float jitter = i < NUM_SAMPLES ? 0.0f : ((state >> 8) / 16777216.0f - 0.5f) * 0.2f;
+            float v = KnnModel::trainingSet.columns[f][base] + jitter;
+            data.rows[size_t(i) * NUM_FEATURES + f] = v;
+            data.columns[f][i] = v;
+        }
+        data.labels[i] = KnnModel::trainingSet.labels[base];
+    }
+
+    for (int f = 0; f < NUM_FEATURES; f++) data.store.columns[f] = data.columns[f].data();
+    data.store.labels = data.labels.data();
+    data.store.size = count;
+}
+
+template <typename Scan>
+double benchmarkScan(const float (*queries)[NUM_FEATURES], int numQueries, int iterations,
+                     int* results, Scan scan) {
+    volatile int sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int it = 0; it < iterations; it++) {
+        for (int q = 0; q < numQueries; q++) {
+            KnnTopK<3> nearest;
+            scan(queries[q], nearest);
+            int c = nearest.vote<4>();
+            if (it == 0) results[q] = c;
+            sink = sink + c;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return ns / (double(iterations) * numQueries);
+}
+
+void runScalingBenchmark(const char* label, const float (*normalized)[NUM_FEATURES]) {
+    static int aosResults[NUM_QUERIES];
+    static int soaResults[NUM_QUERIES];
+    static int kdResults[NUM_QUERIES];
+    const uint32_t sizes[] = {200, 2000, 20000, 200000};
+
+    printf("\nAoS vs SoA vs KD-tree, %s (K=3)\n", label);
+    printf("%-10s %14s %14s %9s %14s %9s %10s\n",
+           "samples", "aos ns/call", "soa ns/call", "speedup", "kd ns/call", "visited", "agree");
+    for (uint32_t size : sizes) {
+        ScaledDataset data;
+        buildScaledDataset(data, size);
+        const float (*rows)[NUM_FEATURES] = reinterpret_cast<const float (*)[NUM_FEATURES]>(data.rows.data());
+        int iterations = size >= 200000 ? 1 : (size >= 20000 ? 4 : (size >= 2000 ? 20 : ITERATIONS));
+
+        KnnKdTree<NUM_FEATURES> tree;
+        tree.build(data.store);
+        uint64_t visitedTotal = 0;
+
+        double aos = benchmarkScan(normalized, NUM_QUERIES, iterations, aosResults,
+            [&](const float* q, KnnTopK<3>& topK) {
+                knnScanRows(q, rows, data.labels.data(), size, topK);
+            });
+        double soa = benchmarkScan(normalized, NUM_QUERIES, iterations, soaResults,
+            [&](const float* q, KnnTopK<3>& topK) {
+                knnScanColumns(q, data.store, topK);
+            });
+
+        double kd = benchmarkScan(normalized, NUM_QUERIES, iterations, kdResults,
+            [&](const float* q, KnnTopK<3>& topK) {
+                uint32_t visited = 0;
+                tree.search(q, topK, &visited);
+                visitedTotal += visited;
+            });
+
+        int agree = 0;
+        for (int q = 0; q < NUM_QUERIES; q++) {
+            if (aosResults[q] == soaResults[q] && aosResults[q] == kdResults[q]) agree++;
+        }
+        double visitedFraction = double(visitedTotal) / (double(iterations) * NUM_QUERIES * size);
+        printf("%-10u %14.1f %14.1f %8.2fx %14.1f %8.1f%% %5d/%d\n", size, aos, soa, aos / soa,
+               kd, 100.0 * visitedFraction, agree, NUM_QUERIES);
+    }
+}
+
+} // namespace
+
+int main() {
+    static Query queries[NUM_QUERIES];
+    generateQueries(queries, NUM_QUERIES);
+    buildTrainingRows();
+    modelTree.build(KnnModel::trainingStore);
+
+    const Backend backends[] = {
+        {"legacy", classifyLegacy},
+        {"prenormalized", classifyPrenormalized},
+        {"topk", classifyTopK},
+        {"soa", classifySoA},
+        {"engine", classifyEngine},
+        {"quant", classifyQuantized},
+        {"kdtree", classifyKdTree},
+        {"grid", classifyGrid},
+    };
+    const int numBackends = sizeof(backends) / sizeof(backends[0]);
+
+    static int reference[NUM_QUERIES];
+    static int results[NUM_QUERIES];
+
+    printf("KNN host benchmark: %d samples, %d queries x %d iterations\n",
+           NUM_SAMPLES, NUM_QUERIES, ITERATIONS);
+    printf("%-16s %12s %10s\n", "backend", "ns/call", "agree");
+
+    double baseline = 0;
+    for (int b = 0; b < numBackends; b++) {
+        double ns = benchmark(backends[b], queries, b == 0 ? reference : results);
+        int agree = NUM_QUERIES;
+        if (b == 0) {
+            baseline = ns;
+        } else {
+            agree = 0;
+            for (int q = 0; q < NUM_QUERIES; q++) {
+                if (results[q] == reference[q]) agree++;
+            }
+        }
+        printf("%-16s %12.1f %9d/%d  (%.2fx)\n", backends[b].name, ns, agree, NUM_QUERIES, baseline / ns);
+    }
+
+    // Query uniform di seluruh range sensor, dan query di sekitar data
+    // (baris training + jitter) yang lebih mirip kondisi motor sebenarnya
+    static float uniform[NUM_QUERIES][NUM_FEATURES];
+    static float nearData[NUM_QUERIES][NUM_FEATURES];
+    uint32_t state = 0xC0FFEEu;
+    for (int q = 0; q < NUM_QUERIES; q++) {
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            uniform[q][f] = queries[q].features[f];
+            state = state * 1664525u + 1013904223u;
+            float jitter = ((state >> 8) / 16777216.0f - 0.5f) * 0.5f;
+            nearData[q][f] = KnnModel::trainingSet.columns[f][q % NUM_SAMPLES] + jitter;
+        }
+        KnnModel::normalizeQuery(uniform[q]);
+    }
+    runScalingBenchmark("uniform queries", uniform);
+    runScalingBenchmark("near-data queries", nearData);
+    return 0;
+}
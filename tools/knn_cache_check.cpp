@@ -0,0 +1,182 @@
+// knn_cache_check.cpp
+// Cek host untuk jalur cache KNNClassifier::classify (knnClassifyCached di
+// KnnBatch.h, cache KnnClassificationCache.h dengan noise floor Config):
+// rules hybrid selalu diputuskan tanpa cache, dan hasil rule tidak pernah
+// terbawa ke input lain di bucket noise floor yang sama, termasuk di batas
+// rule yang jatuh di tengah bucket (AFR 12.0 vs 12.05). Perbedaan KNN di
+// dalam satu bucket (approximation cache yang disengaja) hanya dilaporkan.
+//
+// Build & run (dari root repo):
+//   g++ -O2 -std=c++17 -Isrc tools/knn_cache_check.cpp -o knn_cache_check
+//   ./knn_cache_check [--random N]   (N langkah random walk, default 20000)
+//
+// Exit code 1 jika ada hasil yang berbeda (gate CI).
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "KnnModel.h"
+#include "KnnBatch.h"
+#include "KnnClassificationCache.h"
+
+namespace {
+
+constexpr int K = 3;
+constexpr int NUM_CLASSES = KnnModel::NUM_CLASSES;
+constexpr int D = KnnModel::NUM_FEATURES;
+constexpr int CACHE_SLOTS = 16;  // Config::CLASSIFICATION_CACHE_SLOTS
+
+typedef KnnEngine<KnnModel::NUM_SAMPLES, D, K, NUM_CLASSES> Engine;
+constexpr Engine engine = KnnModel::makeEngine<K, NUM_CLASSES>();
+
+// Field SensorData yang dibaca classifier (tanpa Arduino String)
+struct CheckSensor {
+    float afr;
+    float rpm;
+    float temp;
+    float tps;
+    float map_value;
+    float speed;
+    float incline;
+    float stroke;
+};
+
+// Sama dengan Config::NOISE_FLOOR_* per KnnChannel
+float noiseFloor(KnnChannel channel) {
+    switch (channel) {
+        case KnnChannel::AFR: return 0.1f;
+        case KnnChannel::RPM: return 50.0f;
+        case KnnChannel::TEMP: return 0.5f;
+        case KnnChannel::TPS: return 0.5f;
+        case KnnChannel::MAP: return 1.0f;
+        case KnnChannel::INCLINE: return 0.5f;
+        case KnnChannel::STROKE: return 0.5f;
+        default: return 1.0f;
+    }
+}
+
+int classifyKnn(const float (&features)[D]) {
+    float normalized[D];
+    memcpy(normalized, features, sizeof(normalized));
+    engine.normalize(normalized);
+    return engine.classifyScan(normalized);
+}
+
+int classifyUncached(const CheckSensor& data) {
+    const int rule = knnHybridRule(data);
+    if (rule >= 0) return rule;
+    float features[D];
+    engine.extract(data, features);
+    return classifyKnn(features);
+}
+
+struct CachedClassifier {
+    KnnClassificationCache<CACHE_SLOTS, D> cache;
+    uint32_t knnCalls = 0;
+
+    CachedClassifier() {
+        float floors[D];
+        for (int f = 0; f < D; f++) floors[f] = noiseFloor(engine.channel(f));
+        cache.setNoiseFloor(floors);
+    }
+
+    int classify(const CheckSensor& data) {
+        float features[D];
+        engine.extract(data, features);
+        return knnClassifyCached(cache, data, features, [&]() {
+            knnCalls++;
+            return classifyKnn(features);
+        });
+    }
+};
+
+int failures = 0;
+
+void expectSame(const char* label, CachedClassifier& classifier, const CheckSensor& data) {
+    const int cached = classifier.classify(data);
+    const int expected = classifyUncached(data);
+    if (cached != expected) {
+        printf("FAIL %s: AFR %.2f -> cached %d, uncached %d\n", label, data.afr, cached, expected);
+        failures++;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int randomRuns = 20000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--random") == 0) {
+            randomRuns = atoi(argv[i + 1]);
+        } else {
+            fprintf(stderr, "Usage: knn_cache_check [--random N]\n");
+            return 2;
+        }
+    }
+
+    // Batas rule critical AFR (<= 12.0) di tengah bucket [12.0, 12.1), dua urutan.
+    // Di titik ini KNN memberi Normal (0), jadi hasil rule (3) yang terbawa pasti terdeteksi.
+    const CheckSensor atRule = {12.0f, 4500.0f, 88.0f, 40.0f, 70.0f, 60.0f, 0.0f, 0.0f};
+    CheckSensor pastRule = atRule;
+    pastRule.afr = 12.05f;
+    if (knnHybridRule(atRule) != 3 || classifyUncached(pastRule) == 3) {
+        printf("FAIL setup: boundary inputs no longer straddle rule vs KNN for this model\n");
+        failures++;
+    }
+    {
+        CachedClassifier classifier;
+        expectSame("rule then KNN", classifier, atRule);
+        expectSame("rule then KNN", classifier, pastRule);
+    }
+    {
+        CachedClassifier classifier;
+        expectSame("KNN then rule", classifier, pastRule);
+        expectSame("KNN then rule", classifier, atRule);
+    }
+    {
+        // Bucket yang sama tanpa rule tetap hit: KNN hanya sekali
+        CachedClassifier classifier;
+        CheckSensor next = pastRule;
+        next.afr = 12.08f;
+        expectSame("hit", classifier, pastRule);
+        expectSame("hit", classifier, next);
+        if (classifier.knnCalls != 1) {
+            printf("FAIL hit: %u KNN calls, expected 1\n", (unsigned)classifier.knnCalls);
+            failures++;
+        }
+    }
+
+    // Random walk langkah kecil melintasi threshold rule (AFR 11/12, TPS 1, temp 65/75),
+    // jadi cache banyak hit di bucket yang memotong rule
+    CachedClassifier classifier;
+    uint32_t bucketDiffs = 0;
+    uint32_t state = 12345;
+    auto step = [&state](float value, float delta, float lo, float hi) {
+        state = state * 1664525u + 1013904223u;
+        value += delta * (2.0f * float(state >> 8) / float(1u << 24) - 1.0f);
+        return value < lo ? lo : value > hi ? hi : value;
+    };
+    CheckSensor data = {11.9f, 5000.0f, 70.0f, 1.0f, 60.0f, 0.0f, 0.0f, 0.0f};
+    for (int i = 0; i < randomRuns; i++) {
+        data.afr = step(data.afr, 0.03f, 10.8f, 12.3f);
+        data.rpm = step(data.rpm, 20.0f, 1000.0f, 9000.0f);
+        data.temp = step(data.temp, 0.2f, 60.0f, 80.0f);
+        data.tps = step(data.tps, 0.2f, 0.0f, 2.0f);
+        data.map_value = step(data.map_value, 0.4f, 20.0f, 100.0f);
+        const int rule = knnHybridRule(data);
+        const int cached = classifier.classify(data);
+        if (rule >= 0 && cached != rule) {
+            printf("FAIL random: AFR %.2f TPS %.2f temp %.1f -> cached %d, rule %d\n", data.afr, data.tps, data.temp,
+                   cached, rule);
+            failures++;
+        } else if (rule < 0 && cached != classifyUncached(data)) {
+            bucketDiffs++;
+        }
+    }
+
+    printf("%s: %d failure(s), %d random inputs, cache %u hits / %u misses, %u KNN differences inside a bucket\n",
+           failures ? "FAIL" : "OK", failures, randomRuns, (unsigned)classifier.cache.getHits(),
+           (unsigned)classifier.cache.getMisses(), (unsigned)bucketDiffs);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,246 @@
+// knn_condense.cpp
+// Prototype reduction untuk training set KNN (ENN + CNN + pruning).
+//
+// Build & run (dari root repo):
+//   g++ -O2 -std=c++17 -Isrc tools/knn_condense.cpp -o knn_condense
+//   ./knn_condense src/KnnCondensedData.h
+//
+// Langkah:
+//   1. ENN (Wilson editing): baris yang leave-one-out 3-NN-nya tidak sama
+//      dengan labelnya ditandai noisy dan tidak dipakai sebagai seed.
+//   2. CNN: prototype ditambah sampai setiap baris training diklasifikasi
+//      sama persis dengan model penuh (target = prediksi model penuh, jadi
+//      decision boundary pada data yang ada tidak berubah).
+//   3. Pruning: prototype yang bisa dibuang tanpa merusak konsistensi dihapus.
+// Hasil ditulis sebagai header constexpr yang dipakai KnnModel.h saat build
+// dengan -DKNN_USE_CONDENSED_SET.
+
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+
+#include "KnnTrainingData.h"
+#include "KnnFeatureStore.h"
+#include "KnnBatch.h"
+
+namespace {
+
+constexpr int NUM_FEATURES = KnnTrainingData::NUM_FEATURES;
+constexpr int NUM_SAMPLES = KnnTrainingData::NUM_SAMPLES;
+constexpr int NUM_CLASSES = 4;
+constexpr int K = 3;
+
+float normalized[NUM_SAMPLES][NUM_FEATURES];
+int labels[NUM_SAMPLES];
+
+void normalizeRow(const KnnRawSample& row, float* out) {
+    const float values[NUM_FEATURES] = {row.afr, row.rpm, row.temp, row.tps, row.map_value};
+    for (int f = 0; f < NUM_FEATURES; f++) {
+        out[f] = (values[f] - KnnTrainingData::featureMeans[f]) / KnnTrainingData::featureStds[f];
+    }
+}
+
+// KNN atas subset baris (urutan index asli dipertahankan untuk tie-break).
+// exclude = baris yang dilewati (untuk leave-one-out), -1 jika tidak ada.
+int classifySubset(const float* query, const std::vector<int>& subset, int exclude) {
+    KnnTopK<K> nearest;
+    for (int i : subset) {
+        if (i == exclude) continue;
+        float dist = 0;
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            float diff = query[f] - normalized[i][f];
+            dist += diff * diff;
+        }
+        nearest.offer(dist, uint32_t(i), uint8_t(labels[i]));
+    }
+    return nearest.vote<NUM_CLASSES>();
+}
+
+bool isConsistent(const std::vector<int>& prototypes, const int* target) {
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        if (classifySubset(normalized[i], prototypes, -1) != target[i]) return false;
+    }
+    return true;
+}
+
+// Tambah index ke set terurut; false jika sudah ada
+bool insertSorted(std::vector<int>& set, int index) {
+    auto it = set.begin();
+    while (it != set.end() && *it < index) ++it;
+    if (it != set.end() && *it == index) return false;
+    set.insert(it, index);
+    return true;
+}
+
+// K tetangga terdekat baris i di model penuh (termasuk i sendiri)
+void fullNeighbors(int i, const std::vector<int>& all, int* out) {
+    KnnTopK<K> nearest;
+    for (int j : all) {
+        float dist = 0;
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            float diff = normalized[i][f] - normalized[j][f];
+            dist += diff * diff;
+        }
+        nearest.offer(dist, uint32_t(j), uint8_t(labels[j]));
+    }
+    for (int k = 0; k < nearest.size(); k++) out[k] = int(nearest[k].index);
+}
+
+const char* className(int c) {
+    switch (c) {
+        case 0: return "Normal";
+        case 1: return "Startup";
+        case 2: return "Maintenance";
+        case 3: return "Critical";
+        default: return "Unknown";
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* outputPath = argc > 1 ? argv[1] : "src/KnnCondensedData.h";
+
+    std::vector<int> all;
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        normalizeRow(KnnTrainingData::samples[i], normalized[i]);
+        labels[i] = KnnTrainingData::samples[i].classification;
+        all.push_back(i);
+    }
+
+    // Target: prediksi model penuh untuk setiap baris training
+    int target[NUM_SAMPLES];
+    for (int i = 0; i < NUM_SAMPLES; i++) target[i] = classifySubset(normalized[i], all, -1);
+
+    // 1. ENN: tandai baris noisy
+    bool noisy[NUM_SAMPLES];
+    int noisyCount = 0;
+    for (int i = 0; i < NUM_SAMPLES; i++) {
+        noisy[i] = classifySubset(normalized[i], all, i) != labels[i];
+        if (noisy[i]) noisyCount++;
+    }
+
+    // 2. CNN: seed K baris bersih pertama per kelas, lalu tambah baris yang
+    // masih salah klasifikasi sampai konsisten. Jika baris itu sudah jadi
+    // prototype, tambahkan K tetangganya di model penuh (subset yang memuat
+    // semua tetangga itu pasti memberi vote yang sama dengan model penuh).
+    std::vector<int> prototypes;
+    for (int c = 0; c < NUM_CLASSES; c++) {
+        int taken = 0;
+        for (int i = 0; i < NUM_SAMPLES && taken < K; i++) {
+            if (labels[i] == c && !noisy[i]) {
+                insertSorted(prototypes, i);
+                taken++;
+            }
+        }
+    }
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int i = 0; i < NUM_SAMPLES; i++) {
+            if (classifySubset(normalized[i], prototypes, -1) == target[i]) continue;
+            if (!noisy[i] && insertSorted(prototypes, i)) {
+                changed = true;
+                continue;
+            }
+            int neighbors[K];
+            fullNeighbors(i, all, neighbors);
+            for (int k = 0; k < K; k++) {
+                if (insertSorted(prototypes, neighbors[k])) changed = true;
+            }
+        }
+    }
+    const size_t cnnCount = prototypes.size();
+
+    // 3. Pruning: buang prototype yang tidak dibutuhkan
+    for (size_t p = prototypes.size(); p-- > 0;) {
+        std::vector<int> candidate;
+        for (size_t q = 0; q < prototypes.size(); q++) {
+            if (q != p) candidate.push_back(prototypes[q]);
+        }
+        if (isConsistent(candidate, target)) prototypes = candidate;
+    }
+
+    if (!isConsistent(prototypes, target)) {
+        fprintf(stderr, "ERROR: condensed set is not consistent with the full model\n");
+        return 1;
+    }
+
+    // Agreement di luar data training (informasi saja): query uniform di
+    // seluruh range sensor (KNN saja, dan lewat hybrid rules seperti di
+    // firmware), serta query di sekitar data training
+    static const float lo[NUM_FEATURES] = {10.0f, 0.0f, -40.0f, 0.0f, 0.0f};
+    static const float hi[NUM_FEATURES] = {20.0f, 8000.0f, 150.0f, 100.0f, 250.0f};
+    static const float jitter[NUM_FEATURES] = {0.3f, 300.0f, 5.0f, 5.0f, 10.0f};
+    uint32_t state = 0x51F15EEDu;
+    const int numRandom = 100000;
+    int uniformAgree = 0;
+    int hybridAgree = 0;
+    int nearAgree = 0;
+    for (int n = 0; n < numRandom; n++) {
+        KnnRawSample raw{};
+        KnnRawSample near = KnnTrainingData::samples[n % NUM_SAMPLES];
+        float* fields[NUM_FEATURES] = {&raw.afr, &raw.rpm, &raw.temp, &raw.tps, &raw.map_value};
+        float* nearFields[NUM_FEATURES] = {&near.afr, &near.rpm, &near.temp, &near.tps, &near.map_value};
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            state = state * 1664525u + 1013904223u;
+            float unit = (state >> 8) / 16777216.0f;
+            *fields[f] = lo[f] + unit * (hi[f] - lo[f]);
+            *nearFields[f] += (unit - 0.5f) * 2.0f * jitter[f];
+        }
+
+        float query[NUM_FEATURES];
+        normalizeRow(raw, query);
+        int full = classifySubset(query, all, -1);
+        int condensed = classifySubset(query, prototypes, -1);
+        if (full == condensed) uniformAgree++;
+        int rule = knnHybridRule(raw);
+        if (rule >= 0 || full == condensed) hybridAgree++;
+
+        normalizeRow(near, query);
+        if (knnHybridRule(near) >= 0 ||
+            classifySubset(query, all, -1) == classifySubset(query, prototypes, -1)) nearAgree++;
+    }
+
+    int classCounts[NUM_CLASSES] = {};
+    for (int i : prototypes) classCounts[labels[i]]++;
+
+    printf("KNN condensation (K=%d)\n", K);
+    printf("ENN noisy rows: %d\n", noisyCount);
+    printf("CNN prototypes: %zu, after pruning: %zu of %d\n", cnnCount, prototypes.size(), NUM_SAMPLES);
+    for (int c = 0; c < NUM_CLASSES; c++) {
+        printf("  class %d (%s): %d\n", c, className(c), classCounts[c]);
+    }
+    printf("Training rows consistent with full model: %d/%d\n", NUM_SAMPLES, NUM_SAMPLES);
+    printf("Uniform query agreement, KNN only: %.3f%%\n", 100.0 * uniformAgree / numRandom);
+    printf("Uniform query agreement, with hybrid rules: %.3f%%\n", 100.0 * hybridAgree / numRandom);
+    printf("Near-data query agreement, with hybrid rules: %.3f%%\n", 100.0 * nearAgree / numRandom);
+
+    FILE* out = fopen(outputPath, "w");
+    if (!out) {
+        fprintf(stderr, "ERROR: cannot write %s\n", outputPath);
+        return 1;
+    }
+    fprintf(out, "#ifndef KNN_CONDENSED_DATA_H\n#define KNN_CONDENSED_DATA_H\n\n");
+    fprintf(out, "// KnnCondensedData.h\n");
+    fprintf(out, "// GENERATED oleh tools/knn_condense.cpp - jangan diedit manual.\n");
+    fprintf(out, "// Prototype subset dari KnnTrainingData (%zu dari %d baris) yang\n",
+            prototypes.size(), NUM_SAMPLES);
+    fprintf(out, "// mengklasifikasi semua baris training sama dengan model penuh.\n");
+    fprintf(out, "// Normalisasi tetap memakai KnnTrainingData::featureMeans/featureStds.\n\n");
+    fprintf(out, "#include \"KnnTrainingData.h\"\n\n");
+    fprintf(out, "struct KnnCondensedData {\n");
+    fprintf(out, "    static constexpr int NUM_SAMPLES = %zu;\n\n", prototypes.size());
+    fprintf(out, "    static constexpr KnnRawSample samples[NUM_SAMPLES] = {\n");
+    for (size_t p = 0; p < prototypes.size(); p++) {
+        const KnnRawSample& row = KnnTrainingData::samples[prototypes[p]];
+        fprintf(out, "      {%.1f, %.0f, %.1f, %.1f, %.1f, %d}%s  // Sample %d, Class: %s\n",
+                row.afr, row.rpm, row.temp, row.tps, row.map_value, row.classification,
+                p + 1 < prototypes.size() ? "," : "", prototypes[p] + 1, className(row.classification));
+    }
+    fprintf(out, "    };\n};\n\n#endif // KNN_CONDENSED_DATA_H\n");
+    fclose(out);
+
+    printf("Wrote %s\n", outputPath);
+    return 0;
+}
@@ -0,0 +1,330 @@
+// knn_grid_build.cpp
+// Generator decision grid untuk backend GRID (KnnDecisionGrid.h).
+//
+// Build & run (dari root repo):
+//   g++ -O2 -std=c++17 -Isrc tools/knn_grid_build.cpp -o knn_grid_build
+//   ./knn_grid_build [near_percent] [uniform_percent] [max_kbytes] [output]
+//   (default: 1.0 %, 5.0 %, 256 KB, src/KnnDecisionGridData.h)
+//
+// Resolusi grid (2..128 bin per feature, pangkat 2) dipilih dengan mencoba
+// semua kombinasi yang muat di batas flash, dari yang terkecil, sampai ada
+// yang error-nya di bawah budget. Error diukur lewat
+// jalur hybrid yang sama dengan firmware (rules dulu, KNN untuk sisanya),
+// dibandingkan dengan KNN exact, pada dua set query:
+//   - near-data: baris training + jitter seukuran noise sensor
+//   - uniform: seluruh range sensor
+// Kedua set punya budget: near-data (kondisi motor sebenarnya) dan uniform
+// (input di luar data training, mis. sensor rusak atau mesin baru). Budget
+// uniform memaksa bin dipakai di feature tempat error uniform terkumpul
+// (RPM/MAP), bukan hanya di sekitar data.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+
+#include "KnnModel.h"
+#include "KnnDecisionGrid.h"
+#include "KnnBatch.h"
+
+namespace {
+
+constexpr int NUM_FEATURES = KnnModel::NUM_FEATURES;
+constexpr int SEARCH_QUERIES = 10000;
+constexpr int REPORT_QUERIES = 100000;
+
+const float rangeMin[NUM_FEATURES] = {10.0f, 0.0f, -40.0f, 0.0f, 0.0f};
+const float rangeMax[NUM_FEATURES] = {20.0f, 8000.0f, 150.0f, 100.0f, 250.0f};
+const float noise[NUM_FEATURES] = {0.3f, 300.0f, 5.0f, 5.0f, 10.0f};
+const char* featureNames[NUM_FEATURES] = {"AFR", "RPM", "TEMP", "TPS", "MAP"};
+
+struct Query {
+    float raw[NUM_FEATURES];
+    int exact;  // hasil hybrid dengan KNN exact
+};
+
+int classifyExact(const float* raw) {
+    float features[NUM_FEATURES];
+    for (int f = 0; f < NUM_FEATURES; f++) features[f] = raw[f];
+    KnnModel::normalizeQuery(features);
+    KnnTopK<3> nearest;
+    knnScanColumns(features, KnnModel::trainingStore, nearest);
+    return nearest.vote<4>();
+}
+
+// Vector raw (AFR, RPM, TEMP, TPS, MAP) sebagai baris untuk knnHybridRule
+KnnRawSample rawRow(const float* raw) {
+    return {raw[0], raw[1], raw[2], raw[3], raw[4], -1};
+}
+
+int classifyHybridExact(const float* raw) {
+    int rule = knnHybridRule(rawRow(raw));
+    return rule >= 0 ? rule : classifyExact(raw);
+}
+
+// KNN di titik tengah cell tempat query jatuh (= isi grid untuk cell itu)
+int classifyCellCenter(const KnnGridLayout<NUM_FEATURES>& layout, const float* raw) {
+    float center[NUM_FEATURES];
+    for (int f = 0; f < NUM_FEATURES; f++) {
+        float pos = (raw[f] - layout.rangeMin[f]) * layout.scale[f];
+        int32_t bin = pos > 0 ? int32_t(pos) : 0;
+        if (bin >= layout.bins[f]) bin = layout.bins[f] - 1;
+        center[f] = knnGridBinCenter(layout, f, uint32_t(bin));
+    }
+    return classifyExact(center);
+}
+
+uint32_t nextRandom(uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+float unitRandom(uint32_t& state) {
+    return (nextRandom(state) >> 8) / 16777216.0f;
+}
+
+void generateQueries(std::vector<Query>& uniform, std::vector<Query>& nearData, int count, uint32_t seed) {
+    uniform.resize(count);
+    nearData.resize(count);
+    uint32_t state = seed;
+    for (int n = 0; n < count; n++) {
+        const KnnRawSample& row = KnnTrainingData::samples[n % KnnTrainingData::NUM_SAMPLES];
+        const float base[NUM_FEATURES] = {row.afr, row.rpm, row.temp, row.tps, row.map_value};
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            uniform[n].raw[f] = rangeMin[f] + unitRandom(state) * (rangeMax[f] - rangeMin[f]);
+            float v = base[f] + (unitRandom(state) - 0.5f) * 2.0f * noise[f];
+            v = v < rangeMin[f] ? rangeMin[f] : (v > rangeMax[f] ? rangeMax[f] : v);
+            nearData[n].raw[f] = v;
+        }
+        uniform[n].exact = classifyHybridExact(uniform[n].raw);
+        nearData[n].exact = classifyHybridExact(nearData[n].raw);
+    }
+}
+
+// Jumlah query yang hasil hybrid-nya berubah jika KNN diganti lookup grid.
+// Berhenti lebih awal begitu melewati limit (kandidat sudah kalah).
+int gridWrong(const KnnGridLayout<NUM_FEATURES>& layout, const std::vector<Query>& queries, int limit) {
+    int wrong = 0;
+    for (const Query& q : queries) {
+        if (knnHybridRule(rawRow(q.raw)) >= 0) continue;  // rules selalu sama
+        if (classifyCellCenter(layout, q.raw) != q.exact && ++wrong > limit) break;
+    }
+    return wrong;
+}
+
+double packedKBytes(const uint16_t* bins) {
+    double cells = 1;
+    for (int f = 0; f < NUM_FEATURES; f++) cells *= bins[f];
+    return cells / KNN_GRID_CELLS_PER_BYTE / 1024.0;
+}
+
+KnnGridLayout<NUM_FEATURES> makeLayout(const uint16_t* bins) {
+    uint16_t copy[NUM_FEATURES];
+    for (int f = 0; f < NUM_FEATURES; f++) copy[f] = bins[f];
+    return knnMakeGridLayout(rangeMin, rangeMax, copy);
+}
+
+void printBins(const uint16_t* bins) {
+    for (int f = 0; f < NUM_FEATURES; f++) {
+        printf("%s%s=%u", f ? " " : "", featureNames[f], bins[f]);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const double budget = argc > 1 ? atof(argv[1]) : 1.0;
+    const double uniformBudget = argc > 2 ? atof(argv[2]) : 5.0;
+    const double maxKBytes = argc > 3 ? atof(argv[3]) : 256.0;
+    const char* outputPath = argc > 4 ? argv[4] : "src/KnnDecisionGridData.h";
+
+    std::vector<Query> searchUniform, searchNear;
+    generateQueries(searchUniform, searchNear, SEARCH_QUERIES, 0x6D2B79F5u);
+
+    printf("KNN decision grid build (budget %.2f%% near-data, %.2f%% uniform error, max %.0f KB)\n", budget,
+           uniformBudget, maxKBytes);
+
+    // 1. Pilih resolusi: semua kombinasi bin 2^1..2^7 per feature yang muat
+    // di batas flash, dievaluasi dari yang terkecil. Grid terkecil yang error
+    // near-data dan uniform-nya di bawah budget dipilih.
+    struct Candidate {
+        uint16_t bins[NUM_FEATURES];
+        uint32_t cells;
+    };
+    std::vector<Candidate> candidates;
+    const int maxExponent = 7;
+    int exponents[NUM_FEATURES] = {};
+    for (;;) {
+        Candidate c{};
+        c.cells = 1;
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            c.bins[f] = uint16_t(2u << exponents[f]);
+            c.cells *= c.bins[f];
+        }
+        if (packedKBytes(c.bins) <= maxKBytes) candidates.push_back(c);
+        int f = 0;
+        while (f < NUM_FEATURES && ++exponents[f] == maxExponent) exponents[f++] = 0;
+        if (f == NUM_FEATURES) break;
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const Candidate& a, const Candidate& b) { return a.cells < b.cells; });
+
+    // Dalam satu kelompok ukuran: kandidat yang lolos budget near-data dengan
+    // error uniform terkecil. Selesai begitu kedua budget terpenuhi.
+    const int nearLimit = int(budget * SEARCH_QUERIES / 100.0);
+    const int uniformLimit = int(uniformBudget * SEARCH_QUERIES / 100.0);
+    uint16_t bins[NUM_FEATURES] = {};
+    double nearError = 100.0, uniformError = 100.0;
+    int evaluated = 0;
+    bool found = false;
+    for (size_t i = 0; i < candidates.size();) {
+        size_t j = i;
+        while (j < candidates.size() && candidates[j].cells == candidates[i].cells) j++;
+        int bestNear = SEARCH_QUERIES, bestUniform = SEARCH_QUERIES;
+        size_t best = j;
+        for (size_t k = i; k < j; k++) {
+            const KnnGridLayout<NUM_FEATURES> layout = makeLayout(candidates[k].bins);
+            const int near = gridWrong(layout, searchNear, nearLimit);
+            evaluated++;
+            if (near > nearLimit) continue;
+            const int uniform = gridWrong(layout, searchUniform, bestUniform);
+            if (uniform < bestUniform || (uniform == bestUniform && near < bestNear)) {
+                bestNear = near;
+                bestUniform = uniform;
+                best = k;
+            }
+        }
+        if (best < j && bestUniform * 100.0 / SEARCH_QUERIES < uniformError) {
+            nearError = 100.0 * bestNear / SEARCH_QUERIES;
+            uniformError = 100.0 * bestUniform / SEARCH_QUERIES;
+            for (int f = 0; f < NUM_FEATURES; f++) bins[f] = candidates[best].bins[f];
+            printf("  ");
+            printBins(bins);
+            printf("  %8.1f KB  near %.3f%%  uniform %.3f%%\n", packedKBytes(bins), nearError, uniformError);
+        }
+        if (bestUniform <= uniformLimit) {
+            found = true;
+            break;
+        }
+        i = j;
+    }
+    printf("  %d grid sizes evaluated\n", evaluated);
+    if (!found) {
+        printf("WARNING: no grid within %.0f KB meets both budgets, using the most accurate one\n", maxKBytes);
+        if (bins[0] == 0) {
+            for (int f = 0; f < NUM_FEATURES; f++) bins[f] = candidates.back().bins[f];
+        }
+    }
+
+    // 2. Bangun grid penuh: KNN exact di titik tengah setiap cell
+    const KnnGridLayout<NUM_FEATURES> layout = makeLayout(bins);
+    std::vector<uint8_t> packed(knnGridPackedBytes(layout), 0);
+    uint32_t classCells[4] = {};
+    for (uint32_t cell = 0; cell < layout.numCells; cell++) {
+        float center[NUM_FEATURES];
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            uint32_t bin = (cell / layout.stride[f]) % layout.bins[f];
+            center[f] = knnGridBinCenter(layout, f, bin);
+        }
+        uint8_t code = uint8_t(classifyExact(center));
+        knnGridWriteCode(packed.data(), cell, code);
+        classCells[code]++;
+    }
+
+    // Ukuran alternatif RLE (uint16 panjang + uint8 kelas per run), informasi saja
+    uint32_t runs = 0;
+    for (uint32_t cell = 0; cell < layout.numCells; cell++) {
+        if (cell == 0 || knnGridReadCode(packed.data(), cell) != knnGridReadCode(packed.data(), cell - 1) ||
+            cell % 65535 == 0) {
+            runs++;
+        }
+    }
+
+    // 3. Laporan akhir pada query set terpisah
+    std::vector<Query> reportUniform, reportNear;
+    generateQueries(reportUniform, reportNear, REPORT_QUERIES, 0x1B873593u);
+
+    int nearWrong = 0, uniformWrong = 0, knnOnlyWrong = 0;
+    for (const Query& q : reportNear) {
+        int rule = knnHybridRule(rawRow(q.raw));
+        int result = rule >= 0 ? rule : knnGridLookup(layout, packed.data(), q.raw);
+        if (result != q.exact) nearWrong++;
+    }
+    for (const Query& q : reportUniform) {
+        int rule = knnHybridRule(rawRow(q.raw));
+        int grid = knnGridLookup(layout, packed.data(), q.raw);
+        int result = rule >= 0 ? rule : grid;
+        if (result != q.exact) uniformWrong++;
+        if (grid != classifyExact(q.raw)) knnOnlyWrong++;
+    }
+
+    // Latency host: lookup grid vs scan SoA
+    volatile int sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < 20; rep++) {
+        for (const Query& q : reportUniform) sink = sink + knnGridLookup(layout, packed.data(), q.raw);
+    }
+    auto mid = std::chrono::steady_clock::now();
+    for (const Query& q : reportUniform) sink = sink + classifyExact(q.raw);
+    auto end = std::chrono::steady_clock::now();
+    double gridNs = std::chrono::duration<double, std::nano>(mid - start).count() / (20.0 * REPORT_QUERIES);
+    double scanNs = std::chrono::duration<double, std::nano>(end - mid).count() / REPORT_QUERIES;
+
+    printf("\nSelected grid: ");
+    printBins(bins);
+    printf(" (%u cells)\n", layout.numCells);
+    printf("Flash: %u bytes bit-packed (%d bits/cell), RLE would be %u runs = %u bytes\n",
+           (unsigned)packed.size(), KNN_GRID_BITS_PER_CELL, runs, runs * 3);
+    printf("Cells per class: Normal=%u Startup=%u Maintenance=%u Critical=%u\n",
+           classCells[0], classCells[1], classCells[2], classCells[3]);
+    printf("Hybrid error vs exact KNN: near-data %.3f%%, uniform %.3f%% (KNN-only uniform %.3f%%)\n",
+           100.0 * nearWrong / REPORT_QUERIES, 100.0 * uniformWrong / REPORT_QUERIES,
+           100.0 * knnOnlyWrong / REPORT_QUERIES);
+    printf("Host latency: grid lookup %.1f ns/call, SoA scan %.1f ns/call (%.0fx)\n",
+           gridNs, scanNs, scanNs / gridNs);
+
+    FILE* out = fopen(outputPath, "w");
+    if (!out) {
+        fprintf(stderr, "ERROR: cannot write %s\n", outputPath);
+        return 1;
+    }
+    fprintf(out, "#ifndef KNN_DECISION_GRID_DATA_H\n#define KNN_DECISION_GRID_DATA_H\n\n");
+    fprintf(out, "// KnnDecisionGridData.h\n");
+    fprintf(out, "// GENERATED oleh tools/knn_grid_build.cpp - jangan diedit manual.\n");
+    fprintf(out, "// Keputusan KNN (K=3, %d sampel) di titik tengah setiap cell,\n", KnnModel::NUM_SAMPLES);
+    fprintf(out, "// %u cells x %d bit = %u bytes. Error hybrid vs KNN exact:\n",
+            layout.numCells, KNN_GRID_BITS_PER_CELL, (unsigned)packed.size());
+    fprintf(out, "// near-data %.3f%%, uniform %.3f%%.\n\n",
+            100.0 * nearWrong / REPORT_QUERIES, 100.0 * uniformWrong / REPORT_QUERIES);
+    fprintf(out, "#include <stdint.h>\n#include \"KnnDecisionGrid.h\"\n\n");
+    fprintf(out, "struct KnnDecisionGridData {\n");
+    fprintf(out, "    static constexpr int NUM_FEATURES = %d;\n", NUM_FEATURES);
+    fprintf(out, "    static constexpr float rangeMin[NUM_FEATURES] = {");
+    for (int f = 0; f < NUM_FEATURES; f++) fprintf(out, "%s%.1ff", f ? ", " : "", rangeMin[f]);
+    fprintf(out, "};\n    static constexpr float rangeMax[NUM_FEATURES] = {");
+    for (int f = 0; f < NUM_FEATURES; f++) fprintf(out, "%s%.1ff", f ? ", " : "", rangeMax[f]);
+    fprintf(out, "};\n    static constexpr uint16_t bins[NUM_FEATURES] = {");
+    for (int f = 0; f < NUM_FEATURES; f++) fprintf(out, "%s%u", f ? ", " : "", bins[f]);
+    fprintf(out, "};\n\n");
+    fprintf(out, "    static constexpr KnnGridLayout<NUM_FEATURES> layout =\n");
+    fprintf(out, "        knnMakeGridLayout(rangeMin, rangeMax, bins);\n\n");
+    fprintf(out, "    // Error hybrid vs KNN exact (%%), ditampilkan saat backend GRID dipilih\n");
+    fprintf(out, "    static constexpr float NEAR_ERROR_PERCENT = %.3ff;\n", 100.0 * nearWrong / REPORT_QUERIES);
+    fprintf(out, "    static constexpr float UNIFORM_ERROR_PERCENT = %.3ff;\n\n", 100.0 * uniformWrong / REPORT_QUERIES);
+    fprintf(out, "    static constexpr uint32_t NUM_BYTES = %u;\n", (unsigned)packed.size());
+    fprintf(out, "    static constexpr uint8_t codes[NUM_BYTES] = {\n");
+    for (size_t i = 0; i < packed.size(); i++) {
+        if (i % 16 == 0) fprintf(out, "      ");
+        fprintf(out, "0x%02x%s", packed[i], i + 1 < packed.size() ? "," : "");
+        fprintf(out, (i % 16 == 15 || i + 1 == packed.size()) ? "\n" : " ");
+    }
+    fprintf(out, "    };\n");
+    fprintf(out, "    static_assert(NUM_BYTES == knnGridPackedBytes(layout), \"grid size mismatch\");\n");
+    fprintf(out, "};\n\n#endif // KNN_DECISION_GRID_DATA_H\n");
+    fclose(out);
+
+    printf("Wrote %s\n", outputPath);
+    return 0;
+}
@@ -0,0 +1,391 @@
+// knn_model_pack.cpp
+// Konversi CSV export Python ke model file biner (KnnModelFile.h) yang
+// di-load firmware dari SPIFFS saat boot.
+//
+// Build (dari root repo):
+//   g++ -O2 -std=c++17 -Isrc tools/knn_model_pack.cpp -o knn_model_pack
+//
+// Pemakaian:
+//   ./knn_model_pack pack <input.csv> <output.bin> [--k K] [--classes C]
+//   ./knn_model_pack verify <model.bin>
+//   ./knn_model_pack export-builtin <output.csv>
+//
+// Format CSV: baris pertama header nama kolom feature (afr, rpm, temp, tps,
+// map, incline, stroke; urutan bebas = urutan feature model) diakhiri kolom
+// class. Setiap baris berikutnya satu sample raw. Baris dengan kolom class
+// "mean" atau "std" berisi parameter normalisasi dari scaler Python; jika
+// tidak ada, mean/std (populasi) dihitung dari data CSV.
+//
+// verify me-load file lewat jalur yang sama dengan firmware lalu
+// membandingkan hasilnya dengan model compiled pada training set dan query
+// acak. Untuk upload: taruh output di data/knn_model.bin lalu
+// `pio run -t uploadfs`.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "KnnModel.h"
+#include "KnnModelFile.h"
+
+namespace {
+
+constexpr int DEFAULT_K = 3;
+constexpr int VERIFY_QUERIES = 100000;
+
+struct ChannelName {
+    const char* name;
+    KnnChannel channel;
+};
+
+const ChannelName channelNames[] = {
+    {"afr", KnnChannel::AFR},         {"rpm", KnnChannel::RPM},   {"temp", KnnChannel::TEMP},
+    {"tps", KnnChannel::TPS},         {"map", KnnChannel::MAP},   {"map_value", KnnChannel::MAP},
+    {"incline", KnnChannel::INCLINE}, {"stroke", KnnChannel::STROKE},
+};
+
+std::string lower(std::string s) {
+    for (char& c : s) c = char(tolower((unsigned char)c));
+    return s;
+}
+
+std::string trim(const std::string& s) {
+    size_t begin = s.find_first_not_of(" \t\r\n\"");
+    size_t end = s.find_last_not_of(" \t\r\n\"");
+    return begin == std::string::npos ? std::string() : s.substr(begin, end - begin + 1);
+}
+
+std::vector<std::string> splitCsv(const std::string& line) {
+    std::vector<std::string> cells;
+    size_t start = 0;
+    for (;;) {
+        size_t comma = line.find(',', start);
+        cells.push_back(trim(line.substr(start, comma == std::string::npos ? std::string::npos : comma - start)));
+        if (comma == std::string::npos) break;
+        start = comma + 1;
+    }
+    return cells;
+}
+
+bool parseFloat(const std::string& text, float& value) {
+    char* end = nullptr;
+    value = strtof(text.c_str(), &end);
+    return !text.empty() && end && *end == '\0' && std::isfinite(value);
+}
+
+struct CsvModel {
+    std::vector<KnnChannel> channels;
+    std::vector<std::vector<float>> rows;  // raw, row-major
+    std::vector<int> labels;
+    std::vector<float> means;
+    std::vector<float> stds;
+};
+
+bool readCsv(const char* path, CsvModel& model) {
+    FILE* in = fopen(path, "r");
+    if (!in) {
+        fprintf(stderr, "ERROR: cannot read %s\n", path);
+        return false;
+    }
+
+    std::vector<std::string> lines;
+    char buffer[1024];
+    while (fgets(buffer, sizeof(buffer), in)) {
+        std::string line = trim(buffer);
+        if (!line.empty() && line[0] != '#') lines.push_back(line);
+    }
+    fclose(in);
+
+    if (lines.empty()) {
+        fprintf(stderr, "ERROR: %s is empty\n", path);
+        return false;
+    }
+
+    // Header: kolom feature lalu kolom class (terakhir)
+    std::vector<std::string> header = splitCsv(lines[0]);
+    const int numFeatures = int(header.size()) - 1;
+    if (numFeatures < 1 || numFeatures > KNN_MODEL_FILE_MAX_FEATURES) {
+        fprintf(stderr, "ERROR: expected 1..%d feature columns plus class, got %d columns\n",
+                KNN_MODEL_FILE_MAX_FEATURES, int(header.size()));
+        return false;
+    }
+    for (int f = 0; f < numFeatures; f++) {
+        bool found = false;
+        for (const ChannelName& entry : channelNames) {
+            if (lower(header[f]) == entry.name) {
+                model.channels.push_back(entry.channel);
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            fprintf(stderr, "ERROR: unknown feature column '%s'\n", header[f].c_str());
+            return false;
+        }
+    }
+
+    for (size_t l = 1; l < lines.size(); l++) {
+        std::vector<std::string> cells = splitCsv(lines[l]);
+        if (int(cells.size()) != numFeatures + 1) {
+            fprintf(stderr, "ERROR: line %zu has %zu columns, expected %d\n", l + 1, cells.size(), numFeatures + 1);
+            return false;
+        }
+        std::vector<float> values(numFeatures);
+        for (int f = 0; f < numFeatures; f++) {
+            if (!parseFloat(cells[f], values[f])) {
+                fprintf(stderr, "ERROR: line %zu: bad number '%s'\n", l + 1, cells[f].c_str());
+                return false;
+            }
+        }
+
+        const std::string tag = lower(cells[numFeatures]);
+        if (tag == "mean") {
+            model.means = values;
+        } else if (tag == "std") {
+            model.stds = values;
+        } else {
+            char* end = nullptr;
+            long label = strtol(tag.c_str(), &end, 10);
+            if (tag.empty() || *end != '\0' || label < 0 || label > 255) {
+                fprintf(stderr, "ERROR: line %zu: bad class '%s'\n", l + 1, cells[numFeatures].c_str());
+                return false;
+            }
+            model.rows.push_back(values);
+            model.labels.push_back(int(label));
+        }
+    }
+
+    if (model.rows.empty()) {
+        fprintf(stderr, "ERROR: %s has no samples\n", path);
+        return false;
+    }
+
+    // Tanpa baris mean/std: z-score populasi dari data (StandardScaler)
+    const double n = double(model.rows.size());
+    if (model.means.empty()) {
+        printf("No 'mean' row in CSV, computing means from %zu samples\n", model.rows.size());
+        model.means.assign(numFeatures, 0.0f);
+        for (int f = 0; f < numFeatures; f++) {
+            double sum = 0;
+            for (const auto& row : model.rows) sum += row[f];
+            model.means[f] = float(sum / n);
+        }
+    }
+    if (model.stds.empty()) {
+        printf("No 'std' row in CSV, computing population stds from %zu samples\n", model.rows.size());
+        model.stds.assign(numFeatures, 0.0f);
+        for (int f = 0; f < numFeatures; f++) {
+            double sum = 0;
+            for (const auto& row : model.rows) sum += (row[f] - model.means[f]) * (row[f] - model.means[f]);
+            model.stds[f] = float(std::sqrt(sum / n));
+        }
+    }
+    for (int f = 0; f < numFeatures; f++) {
+        if (!(model.stds[f] > 0.0f)) {
+            fprintf(stderr, "ERROR: std of column '%s' is not positive\n", header[f].c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void append(std::vector<uint8_t>& out, const T* values, size_t count) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values);
+    out.insert(out.end(), bytes, bytes + count * sizeof(T));
+}
+
+int pack(const char* inputPath, const char* outputPath, int kValue, int numClasses) {
+    CsvModel model;
+    if (!readCsv(inputPath, model)) return 1;
+
+    const uint32_t d = uint32_t(model.channels.size());
+    const uint32_t n = uint32_t(model.rows.size());
+    if (kValue < 1 || uint32_t(kValue) > n) {
+        fprintf(stderr, "ERROR: K=%d must be between 1 and %u samples\n", kValue, n);
+        return 1;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        if (model.labels[i] >= numClasses) {
+            fprintf(stderr, "ERROR: sample %u has class %d, model has %d classes\n", i + 1, model.labels[i],
+                    numClasses);
+            return 1;
+        }
+    }
+
+    // Normalisasi dan kuantisasi dengan rumus yang sama dengan KnnModel.h
+    std::vector<float> columns(size_t(d) * n);
+    std::vector<int16_t> quantized(size_t(d) * n);
+    std::vector<uint8_t> labels(n);
+    for (uint32_t f = 0; f < d; f++) {
+        for (uint32_t i = 0; i < n; i++) {
+            const float z = (model.rows[i][f] - model.means[f]) / model.stds[f];
+            columns[size_t(f) * n + i] = z;
+            quantized[size_t(f) * n + i] = knnQuantize(z);
+        }
+    }
+    for (uint32_t i = 0; i < n; i++) labels[i] = uint8_t(model.labels[i]);
+
+    std::vector<uint8_t> payload;
+    append(payload, model.means.data(), d);
+    append(payload, model.stds.data(), d);
+    append(payload, columns.data(), columns.size());
+    append(payload, quantized.data(), quantized.size());
+    append(payload, labels.data(), labels.size());
+
+    KnnModelFileHeader header{};
+    header.magic = KNN_MODEL_FILE_MAGIC;
+    header.version = KNN_MODEL_FILE_VERSION;
+    header.headerSize = sizeof(KnnModelFileHeader);
+    header.numFeatures = uint16_t(d);
+    header.numClasses = uint16_t(numClasses);
+    header.kValue = uint16_t(kValue);
+    header.numSamples = n;
+    header.payloadSize = uint32_t(payload.size());
+    header.payloadCrc = knnCrc32(payload.data(), payload.size());
+    for (uint32_t f = 0; f < d; f++) header.channels[f] = uint8_t(model.channels[f]);
+
+    if (payload.size() != knnModelFilePayloadSize(d, n)) {
+        fprintf(stderr, "ERROR: payload layout mismatch\n");
+        return 1;
+    }
+
+    FILE* out = fopen(outputPath, "wb");
+    if (!out) {
+        fprintf(stderr, "ERROR: cannot write %s\n", outputPath);
+        return 1;
+    }
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(payload.data(), 1, payload.size(), out);
+    fclose(out);
+
+    printf("Wrote %s: %u samples, %u features (", outputPath, n, d);
+    for (uint32_t f = 0; f < d; f++) printf("%s%s", f ? ", " : "", knnChannelName(model.channels[f]));
+    printf("), %d classes, K=%d\n", numClasses, kValue);
+    printf("Size: %zu bytes, CRC32 %08X\n", sizeof(header) + payload.size(), (unsigned)header.payloadCrc);
+    return 0;
+}
+
+int exportBuiltin(const char* outputPath) {
+    FILE* out = fopen(outputPath, "w");
+    if (!out) {
+        fprintf(stderr, "ERROR: cannot write %s\n", outputPath);
+        return 1;
+    }
+    constexpr int D = KnnTrainingData::NUM_FEATURES;
+    for (int f = 0; f < D; f++) fprintf(out, "%s,", lower(knnChannelName(KnnTrainingData::channels[f])).c_str());
+    fprintf(out, "class\n");
+    for (const KnnRawSample& sample : KnnTrainingData::samples) {
+        for (int f = 0; f < D; f++) fprintf(out, "%.9g,", sample.feature(f));
+        fprintf(out, "%d\n", sample.classification);
+    }
+    for (int f = 0; f < D; f++) fprintf(out, "%.9g,", KnnTrainingData::featureMeans[f]);
+    fprintf(out, "mean\n");
+    for (int f = 0; f < D; f++) fprintf(out, "%.9g,", KnnTrainingData::featureStds[f]);
+    fprintf(out, "std\n");
+    fclose(out);
+    printf("Wrote %s: %d compiled-in samples\n", outputPath, KnnTrainingData::NUM_SAMPLES);
+    return 0;
+}
+
+int verify(const char* path) {
+    constexpr int D = KnnModel::NUM_FEATURES;
+    constexpr int C = KnnModel::NUM_CLASSES;
+    typedef KnnEngine<KnnModel::NUM_SAMPLES, D, DEFAULT_K, C> Engine;
+
+    FILE* in = fopen(path, "rb");
+    if (!in) {
+        fprintf(stderr, "ERROR: cannot read %s\n", path);
+        return 1;
+    }
+    fseek(in, 0, SEEK_END);
+    const long size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    std::vector<uint32_t> image((size_t(size) + 3) / 4);  // 4-byte aligned seperti new[] di firmware
+    const size_t read = fread(image.data(), 1, size_t(size), in);
+    fclose(in);
+
+    KnnModelFileView<D> view;
+    KnnModelFileStatus status =
+        knnBindModelFile(reinterpret_cast<const uint8_t*>(image.data()), read, DEFAULT_K, C, view);
+    printf("%s: %s\n", path, knnModelFileStatusText(status));
+    if (status != KnnModelFileStatus::OK) return 1;
+
+    printf("Samples: %u, features:", (unsigned)view.store.size);
+    for (int f = 0; f < D; f++) printf("%s %s", f ? "," : "", knnChannelName(view.channels[f]));
+    printf(", classes: %d, K=%d\n", view.numClasses, view.kValue);
+
+    const Engine fileEngine(view.channels, view.means, view.stds, view.store, view.quantizedStore);
+    constexpr Engine builtinEngine = KnnModel::makeEngine<DEFAULT_K, C>();
+
+    // Training set compiled (raw) lewat kedua model
+    int agree = 0;
+    int quantAgree = 0;
+    for (const KnnRawSample& sample : KnnTrainingData::samples) {
+        float a[D], b[D];
+        for (int f = 0; f < D; f++) a[f] = b[f] = sample.feature(f);
+        fileEngine.normalize(a);
+        builtinEngine.normalize(b);
+        if (fileEngine.classifyScan(a) == builtinEngine.classifyScan(b)) agree++;
+        if (fileEngine.classifyQuantized(a) == builtinEngine.classifyQuantized(b)) quantAgree++;
+    }
+    printf("Compiled training set: float %d/%d, quantized %d/%d agree with compiled model\n", agree,
+           KnnTrainingData::NUM_SAMPLES, quantAgree, KnnTrainingData::NUM_SAMPLES);
+
+    const float rangeMin[KnnTrainingData::NUM_FEATURES] = {10.0f, 0.0f, -40.0f, 0.0f, 0.0f};
+    const float rangeMax[KnnTrainingData::NUM_FEATURES] = {20.0f, 8000.0f, 150.0f, 100.0f, 250.0f};
+    uint32_t seed = 12345;
+    int randomAgree = 0;
+    for (int q = 0; q < VERIFY_QUERIES; q++) {
+        float a[D], b[D];
+        for (int f = 0; f < D; f++) {
+            seed = seed * 1664525u + 1013904223u;
+            a[f] = b[f] = rangeMin[f] + (rangeMax[f] - rangeMin[f]) * float(seed >> 8) / float(1 << 24);
+        }
+        fileEngine.normalize(a);
+        builtinEngine.normalize(b);
+        if (fileEngine.classifyScan(a) == builtinEngine.classifyScan(b)) randomAgree++;
+    }
+    printf("Random queries: %d/%d agree with compiled model\n", randomAgree, VERIFY_QUERIES);
+    return 0;
+}
+
+void usage() {
+    fprintf(stderr,
+            "Usage:\n"
+            "  knn_model_pack pack <input.csv> <output.bin> [--k K] [--classes C]\n"
+            "  knn_model_pack verify <model.bin>\n"
+            "  knn_model_pack export-builtin <output.csv>\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc >= 4 && strcmp(argv[1], "pack") == 0) {
+        int kValue = DEFAULT_K;
+        int numClasses = KnnTrainingData::NUM_CLASSES;
+        for (int i = 4; i + 1 < argc; i += 2) {
+            if (strcmp(argv[i], "--k") == 0) {
+                kValue = atoi(argv[i + 1]);
+            } else if (strcmp(argv[i], "--classes") == 0) {
+                numClasses = atoi(argv[i + 1]);
+            } else {
+                usage();
+                return 2;
+            }
+        }
+        if (numClasses < 1 || numClasses > 256) {
+            fprintf(stderr, "ERROR: classes must be between 1 and 256\n");
+            return 2;
+        }
+        return pack(argv[2], argv[3], kValue, numClasses);
+    }
+    if (argc == 3 && strcmp(argv[1], "verify") == 0) return verify(argv[2]);
+    if (argc == 3 && strcmp(argv[1], "export-builtin") == 0) return exportBuiltin(argv[2]);
+    usage();
+    return 2;
+}
@@ -0,0 +1,135 @@
+// knn_profile.cpp
+// Versi host dari serial BENCH_AI: harness KnnProfiler.h yang sama, input
+// sintetis yang sama, dan jalur hybrid yang sama dengan
+// KNNClassifier::classify tanpa cache (rules lalu backend). Dipakai untuk
+// membandingkan backend di CI.
+//
+// Build & run (dari root repo):
+//   g++ -O2 -std=c++17 -Isrc tools/knn_profile.cpp -o knn_profile
+//   ./knn_profile [--runs N] [--backend FLOAT|QUANT|KDTREE|GRID] [--max-p99 US]
+//
+// --max-p99 membuat exit code 1 jika p99 backend mana pun melebihi US
+// mikrodetik (gate regresi latency di CI).
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "KnnModel.h"
+#include "KnnBatch.h"
+#include "KnnProfiler.h"
+
+namespace {
+
+constexpr int K = 3;
+constexpr int NUM_CLASSES = KnnModel::NUM_CLASSES;
+
+typedef KnnEngine<KnnModel::NUM_SAMPLES, KnnModel::NUM_FEATURES, K, NUM_CLASSES> Engine;
+constexpr Engine engine = KnnModel::makeEngine<K, NUM_CLASSES>();
+
+// Field SensorData yang dibaca classifier (tanpa Arduino String)
+struct BenchSensor {
+    float afr;
+    float rpm;
+    float temp;
+    float tps;
+    float map_value;
+    float speed;
+    float incline;
+    float stroke;
+};
+
+const KnnBackend allBackends[] = {KnnBackend::FLOAT_SCAN, KnnBackend::QUANTIZED, KnnBackend::KD_TREE,
+                                  KnnBackend::DECISION_GRID};
+
+const char* backendName(KnnBackend backend) {
+    switch (backend) {
+        case KnnBackend::FLOAT_SCAN: return "FLOAT";
+        case KnnBackend::QUANTIZED: return "QUANT";
+        case KnnBackend::KD_TREE: return "KDTREE";
+        case KnnBackend::DECISION_GRID: return "GRID";
+        default: return "UNKNOWN";
+    }
+}
+
+bool parseBackend(const char* name, KnnBackend& backend) {
+    for (KnnBackend candidate : allBackends) {
+        if (strcmp(name, backendName(candidate)) == 0) {
+            backend = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Sama dengan KNNClassifier::classifyUncached
+int classifyOne(const BenchSensor& data, KnnBackend backend, const Engine::KdTree& tree) {
+    const int rule = knnHybridRule(data);
+    if (rule >= 0) return rule;
+    if (backend == KnnBackend::DECISION_GRID) return knnGridClassify(data);
+
+    float features[KnnModel::NUM_FEATURES];
+    engine.extract(data, features);
+    engine.normalize(features);
+    switch (backend) {
+        case KnnBackend::QUANTIZED: return engine.classifyQuantized(features);
+        case KnnBackend::KD_TREE: return engine.classifyKdTree(tree, features);
+        default: return engine.classifyScan(features);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t runs = 1000;
+    float maxP99 = 0;
+    bool singleBackend = false;
+    KnnBackend selected = KnnBackend::FLOAT_SCAN;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--runs") == 0) {
+            runs = atoi(argv[i + 1]) > 0 ? uint32_t(atoi(argv[i + 1])) : 1;
+        } else if (strcmp(argv[i], "--max-p99") == 0) {
+            maxP99 = float(atof(argv[i + 1]));
+        } else if (strcmp(argv[i], "--backend") == 0) {
+            if (!parseBackend(argv[i + 1], selected)) {
+                fprintf(stderr, "ERROR: unknown backend '%s'\n", argv[i + 1]);
+                return 2;
+            }
+            singleBackend = true;
+        } else {
+            fprintf(stderr, "Usage: knn_profile [--runs N] [--backend FLOAT|QUANT|KDTREE|GRID] [--max-p99 US]\n");
+            return 2;
+        }
+    }
+
+    Engine::KdTree tree;
+    if (!engine.buildKdTree(tree)) {
+        fprintf(stderr, "ERROR: KD-tree build failed\n");
+        return 1;
+    }
+
+    BenchSensor inputs[KNN_BENCH_INPUTS];
+    knnBenchInputs(inputs);
+    std::vector<float> samples(runs);
+
+    printf("Model: %d samples%s, K=%d, %u runs/backend, %d inputs\n", KnnModel::NUM_SAMPLES,
+           KnnModel::isCondensed() ? " (condensed)" : "", K, (unsigned)runs, KNN_BENCH_INPUTS);
+    printf("backend      min_us  median_us     p99_us     max_us    mean_us\n");
+
+    bool overBudget = false;
+    for (KnnBackend backend : allBackends) {
+        if (singleBackend && backend != selected) continue;
+        const KnnBenchStats stats = knnBenchmark(inputs, KNN_BENCH_INPUTS, runs, samples.data(),
+                                                 [&](const BenchSensor& data) {
+                                                     return classifyOne(data, backend, tree);
+                                                 });
+        printf("%-8s %10.2f %10.2f %10.2f %10.2f %10.2f\n", backendName(backend), stats.minMicros,
+               stats.medianMicros, stats.p99Micros, stats.maxMicros, stats.meanMicros);
+        if (maxP99 > 0 && stats.p99Micros > maxP99) {
+            fprintf(stderr, "FAIL: %s p99 %.2f us > %.2f us\n", backendName(backend), stats.p99Micros, maxP99);
+            overBudget = true;
+        }
+    }
+    return overBudget ? 1 : 0;
+}
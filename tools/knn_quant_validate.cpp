@@ -0,0 +1,96 @@
+// knn_quant_validate.cpp
+// Validasi engine KNN quantized (int16 Q6.9) terhadap jalur float.
+//
+// Build & run:
+//   g++ -O2 -std=c++17 -Isrc tools/knn_quant_validate.cpp -o knn_quant_validate && ./knn_quant_validate
+//
+// 1. Replay seluruh training set (nilai raw -> normalisasi -> kedua engine)
+// 2. Query acak di seluruh range sensor
+// Exit code 1 jika ada baris training set yang hasilnya berbeda.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+
+#include "KnnModel.h"
+
+namespace {
+
+constexpr int NUM_FEATURES = KnnModel::NUM_FEATURES;
+constexpr int NUM_SAMPLES = KnnModel::NUM_SAMPLES;
+constexpr int NUM_TRAINING_ROWS = KnnTrainingData::NUM_SAMPLES;
+constexpr int NUM_RANDOM_QUERIES = 100000;
+
+int classifyFloat(const float* normalized) {
+    KnnTopK<3> nearest;
+    knnScanColumns(normalized, KnnModel::trainingStore, nearest);
+    return nearest.vote<4>();
+}
+
+int classifyQuantized(const float* normalized) {
+    int16_t quantized[NUM_FEATURES];
+    KnnModel::quantizeQuery(normalized, quantized);
+    KnnTopK<3, uint32_t> nearest;
+    knnScanQuantized(quantized, KnnModel::quantizedStore, nearest);
+    return nearest.vote<4>();
+}
+
+} // namespace
+
+int main() {
+    // Error kuantisasi pada model
+    float maxError = 0;
+    for (int f = 0; f < NUM_FEATURES; f++) {
+        for (int i = 0; i < NUM_SAMPLES; i++) {
+            float z = KnnModel::trainingSet.columns[f][i];
+            float err = std::fabs(knnDequantize(KnnModel::quantizedSet.columns[f][i]) - z);
+            if (err > maxError) maxError = err;
+        }
+    }
+
+    printf("Quantized KNN validation (Q%d.%d, K=3)\n", 15 - KNN_Q_FRAC_BITS, KNN_Q_FRAC_BITS);
+    printf("Model size: float %zu bytes, int16 %zu bytes\n",
+           sizeof(KnnModel::trainingSet), sizeof(KnnModel::quantizedSet));
+    printf("Max quantization error: %.6f std (LSB %.6f)\n", maxError, 1.0f / KNN_Q_SCALE);
+
+    // 1. Replay training set (selalu 200 baris penuh, juga saat model condensed)
+    int trainingAgree = 0;
+    int labelAgreeFloat = 0;
+    int labelAgreeQuant = 0;
+    for (int i = 0; i < NUM_TRAINING_ROWS; i++) {
+        const KnnRawSample& row = KnnTrainingData::samples[i];
+        float features[NUM_FEATURES] = {row.afr, row.rpm, row.temp, row.tps, row.map_value};
+        KnnModel::normalizeQuery(features);
+
+        int f = classifyFloat(features);
+        int q = classifyQuantized(features);
+        if (f == q) {
+            trainingAgree++;
+        } else {
+            printf("  mismatch sample %d: float=%d quant=%d label=%d\n", i + 1, f, q, row.classification);
+        }
+        if (f == row.classification) labelAgreeFloat++;
+        if (q == row.classification) labelAgreeQuant++;
+    }
+    printf("Training set replay: %d/%d agree (label accuracy float %d/%d, quant %d/%d)\n",
+           trainingAgree, NUM_TRAINING_ROWS, labelAgreeFloat, NUM_TRAINING_ROWS, labelAgreeQuant, NUM_TRAINING_ROWS);
+
+    // 2. Query acak di seluruh range sensor
+    static const float lo[NUM_FEATURES] = {10.0f, 0.0f, -40.0f, 0.0f, 0.0f};
+    static const float hi[NUM_FEATURES] = {20.0f, 8000.0f, 150.0f, 100.0f, 250.0f};
+    uint32_t state = 0x2545F491u;
+    int randomAgree = 0;
+    for (int n = 0; n < NUM_RANDOM_QUERIES; n++) {
+        float features[NUM_FEATURES];
+        for (int f = 0; f < NUM_FEATURES; f++) {
+            state = state * 1664525u + 1013904223u;
+            features[f] = lo[f] + ((state >> 8) / 16777216.0f) * (hi[f] - lo[f]);
+        }
+        KnnModel::normalizeQuery(features);
+        if (classifyFloat(features) == classifyQuantized(features)) randomAgree++;
+    }
+    printf("Random queries: %d/%d agree (%.3f%%)\n",
+           randomAgree, NUM_RANDOM_QUERIES, 100.0 * randomAgree / NUM_RANDOM_QUERIES);
+
+    return trainingAgree == NUM_TRAINING_ROWS ? 0 : 1;
+}
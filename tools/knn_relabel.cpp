@@ -0,0 +1,230 @@
+// knn_relabel.cpp
+// Re-label rekaman /telemetry_data.txt dengan model KNN compiled, lewat
+// knnClassifyBatch (jalur yang sama dengan KNNClassifier::classifyBatch),
+// memakai semua core CPU host.
+//
+// Build & run (dari root repo):
+//   g++ -O2 -std=c++17 -pthread -Isrc tools/knn_relabel.cpp -o knn_relabel
+//   ./knn_relabel telemetry_data.txt [--threads N] [--backend FLOAT|QUANT|KDTREE|GRID]
+//                 [--repeat R] [--out labels.csv]
+//
+// Output: distribusi kelas per lap, throughput (rows/s) untuk jalur per baris
+// (seperti classify() tanpa cache), batch 1 thread, dan batch N thread.
+// --repeat mengulang klasifikasi R kali untuk log kecil supaya waktu terukur.
+// --out menulis lapNumber,timestamp,class per baris data.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "KnnModel.h"
+#include "KnnBatch.h"
+#include "TelemetryLog.h"
+
+namespace {
+
+constexpr int K = 3;
+constexpr int NUM_CLASSES = KnnModel::NUM_CLASSES;
+constexpr int MAX_LAPS = 32;
+
+typedef KnnEngine<KnnModel::NUM_SAMPLES, KnnModel::NUM_FEATURES, K, NUM_CLASSES> Engine;
+constexpr Engine engine = KnnModel::makeEngine<K, NUM_CLASSES>();
+
+// Field yang sama dengan SensorData (tanpa Arduino String)
+struct LogRow {
+    int lapNumber;
+    float afr;
+    float rpm;
+    float temp;
+    float tps;
+    float map_value;
+    double lat;
+    double lng;
+    float speed;
+    float incline;
+    float stroke;
+    int64_t timestampMicros;
+    int64_t utcMicros;
+};
+
+bool parseBackend(const char* name, KnnBackend& backend) {
+    if (strcmp(name, "FLOAT") == 0) backend = KnnBackend::FLOAT_SCAN;
+    else if (strcmp(name, "QUANT") == 0) backend = KnnBackend::QUANTIZED;
+    else if (strcmp(name, "KDTREE") == 0) backend = KnnBackend::KD_TREE;
+    else if (strcmp(name, "GRID") == 0) backend = KnnBackend::DECISION_GRID;
+    else return false;
+    return true;
+}
+
+// Referensi: satu baris per panggilan, seperti KNNClassifier::classify tanpa cache
+int classifyRow(const LogRow& row, KnnBackend backend, const Engine::KdTree& tree) {
+    const int rule = knnHybridRule(row);
+    if (rule >= 0) return rule;
+    if (backend == KnnBackend::DECISION_GRID) return knnGridClassify(row);
+
+    float features[KnnModel::NUM_FEATURES];
+    engine.extract(row, features);
+    engine.normalize(features);
+    switch (backend) {
+        case KnnBackend::QUANTIZED: return engine.classifyQuantized(features);
+        case KnnBackend::KD_TREE: return engine.classifyKdTree(tree, features);
+        default: return engine.classifyScan(features);
+    }
+}
+
+template <typename F>
+double timeRows(int repeat, size_t rows, F&& run) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeat; r++) run();
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return seconds > 0 ? double(rows) * repeat / seconds : 0.0;
+}
+
+void classifyParallel(const std::vector<LogRow>& rows, std::vector<int>& labels, KnnBackend backend,
+                      const Engine::KdTree& tree, int threads) {
+    // Chunk kelipatan KNN_BATCH_BLOCK supaya setiap thread memproses blok penuh
+    const size_t blocks = (rows.size() + KNN_BATCH_BLOCK - 1) / KNN_BATCH_BLOCK;
+    const size_t chunk = (blocks + threads - 1) / threads * KNN_BATCH_BLOCK;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        const size_t begin = size_t(t) * chunk;
+        if (begin >= rows.size()) break;
+        const size_t count = rows.size() - begin < chunk ? rows.size() - begin : chunk;
+        workers.emplace_back([&, begin, count]() {
+            knnClassifyBatch(engine, backend, &tree, rows.data() + begin, count, labels.data() + begin);
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: knn_relabel <telemetry_data.txt> [--threads N] [--backend FLOAT|QUANT|KDTREE|GRID] "
+                        "[--repeat R] [--out labels.csv]\n");
+        return 2;
+    }
+
+    int threads = int(std::thread::hardware_concurrency());
+    if (threads < 1) threads = 1;
+    int repeat = 1;
+    KnnBackend backend = KnnBackend::FLOAT_SCAN;
+    const char* outputPath = nullptr;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--threads") == 0) {
+            threads = atoi(argv[i + 1]) > 0 ? atoi(argv[i + 1]) : 1;
+        } else if (strcmp(argv[i], "--repeat") == 0) {
+            repeat = atoi(argv[i + 1]) > 0 ? atoi(argv[i + 1]) : 1;
+        } else if (strcmp(argv[i], "--backend") == 0) {
+            if (!parseBackend(argv[i + 1], backend)) {
+                fprintf(stderr, "ERROR: unknown backend '%s'\n", argv[i + 1]);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--out") == 0) {
+            outputPath = argv[i + 1];
+        } else {
+            fprintf(stderr, "ERROR: unknown option '%s'\n", argv[i]);
+            return 2;
+        }
+    }
+
+    // Stream file: satu baris di-parse langsung ke LogRow
+    FILE* in = fopen(argv[1], "r");
+    if (!in) {
+        fprintf(stderr, "ERROR: cannot read %s\n", argv[1]);
+        return 1;
+    }
+    std::vector<LogRow> rows;
+    size_t skipped = 0;
+    char line[512];
+    auto parseStart = std::chrono::steady_clock::now();
+    while (fgets(line, sizeof(line), in)) {
+        LogRow row;
+        if (parseTelemetryLogLine(line, row)) {
+            rows.push_back(row);
+        } else {
+            skipped++;
+        }
+    }
+    fclose(in);
+    double parseSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - parseStart).count();
+    if (rows.empty()) {
+        fprintf(stderr, "ERROR: no data rows in %s\n", argv[1]);
+        return 1;
+    }
+
+    Engine::KdTree tree;
+    if (backend == KnnBackend::KD_TREE && !engine.buildKdTree(tree)) {
+        fprintf(stderr, "ERROR: KD-tree build failed\n");
+        return 1;
+    }
+
+    printf("%s: %zu data rows, %zu header/comment lines skipped, parsed at %.0f rows/s\n", argv[1], rows.size(),
+           skipped, parseSeconds > 0 ? rows.size() / parseSeconds : 0.0);
+    printf("Model: %d samples%s, K=%d, backend %d\n", KnnModel::NUM_SAMPLES,
+           KnnModel::isCondensed() ? " (condensed)" : "", K, int(backend));
+
+    // Jalur per baris sebagai referensi (hasil dan throughput)
+    std::vector<int> reference(rows.size());
+    const double rowRate = timeRows(repeat, rows.size(), [&]() {
+        for (size_t i = 0; i < rows.size(); i++) reference[i] = classifyRow(rows[i], backend, tree);
+    });
+
+    std::vector<int> labels(rows.size());
+    const double batchRate = timeRows(repeat, rows.size(), [&]() {
+        knnClassifyBatch(engine, backend, &tree, rows.data(), rows.size(), labels.data());
+    });
+    size_t mismatches = 0;
+    for (size_t i = 0; i < rows.size(); i++) mismatches += labels[i] != reference[i];
+
+    std::vector<int> parallel(rows.size());
+    const double parallelRate = timeRows(repeat, rows.size(), [&]() {
+        classifyParallel(rows, parallel, backend, tree, threads);
+    });
+    for (size_t i = 0; i < rows.size(); i++) mismatches += parallel[i] != reference[i];
+
+    printf("\nThroughput (%d repeat%s)\n", repeat, repeat > 1 ? "s" : "");
+    printf("%-22s %14.0f rows/s\n", "per-row classify", rowRate);
+    printf("%-22s %14.0f rows/s  (%.2fx)\n", "batch, 1 thread", batchRate, batchRate / rowRate);
+    char parallelName[32];
+    snprintf(parallelName, sizeof(parallelName), "batch, %d threads", threads);
+    printf("%-22s %14.0f rows/s  (%.2fx)\n", parallelName, parallelRate, parallelRate / rowRate);
+    printf("Mismatches vs per-row: %zu\n", mismatches);
+
+    // Distribusi kelas per lap
+    uint32_t lapCounts[MAX_LAPS + 1][NUM_CLASSES] = {};
+    for (size_t i = 0; i < rows.size(); i++) {
+        int lap = rows[i].lapNumber;
+        if (lap < 0 || lap > MAX_LAPS) lap = 0;
+        lapCounts[lap][labels[i]]++;
+    }
+    printf("\nlap       rows     Normal    Startup  Maintenance   Critical\n");
+    for (int lap = 0; lap <= MAX_LAPS; lap++) {
+        uint32_t total = 0;
+        for (int c = 0; c < NUM_CLASSES; c++) total += lapCounts[lap][c];
+        if (total == 0) continue;
+        printf("%-5d %8u %10u %10u %12u %10u\n", lap, total, lapCounts[lap][0], lapCounts[lap][1],
+               lapCounts[lap][2], lapCounts[lap][3]);
+    }
+
+    if (outputPath) {
+        FILE* out = fopen(outputPath, "w");
+        if (!out) {
+            fprintf(stderr, "ERROR: cannot write %s\n", outputPath);
+            return 1;
+        }
+        fprintf(out, "lapNumber,timestamp,class\n");
+        for (size_t i = 0; i < rows.size(); i++) {
+            fprintf(out, "%d,%lld,%d\n", rows[i].lapNumber, (long long)rows[i].timestampMicros, labels[i]);
+        }
+        fclose(out);
+        printf("\nWrote %s\n", outputPath);
+    }
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,216 @@
+// sensor_pipeline.cpp
+// Jalankan pipeline sumber sensor -> klasifikasi -> log di host, dengan
+// sumber yang sama seperti serial SENSOR_SOURCE di firmware:
+//   SIM     SimulatedSensorSource (lap parametrik deterministik)
+//   REPLAY  ReplaySensorSource atas file rekaman /telemetry_data.txt
+// Waktu disimulasikan (langkah 100 ms, periode IDLE RPM/TPS), replay
+// AS_FAST_AS_POSSIBLE, jadi satu sesi 10 menit selesai dalam milidetik.
+//
+// Build & run (dari root repo):
+//   g++ -O2 -std=c++17 -Isrc tools/sensor_pipeline.cpp -o sensor_pipeline
+//   ./sensor_pipeline SIM [--seconds S] [--seed N] [--out log.txt]
+//   ./sensor_pipeline REPLAY telemetry_data.txt [--out log.txt]
+//
+// Output: distribusi kelas per lap, throughput (rows/s) dan checksum
+// urutan kelas; dua run dengan input sama harus menghasilkan checksum
+// yang sama. --out menulis log dalam format RecordingManager (bisa
+// di-replay lagi atau di-relabel dengan knn_relabel).
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "KnnModel.h"
+#include "KnnBatch.h"
+#include "SimulatedSensorSource.h"
+#include "ReplaySensorSource.h"
+
+namespace {
+
+constexpr int K = 3;
+constexpr int NUM_CLASSES = KnnModel::NUM_CLASSES;
+constexpr int MAX_LAPS = 32;
+constexpr unsigned long STEP_MILLIS = 100;  // Config::SENSOR_PERIOD_IDLE_MS RPM/TPS
+
+typedef KnnEngine<KnnModel::NUM_SAMPLES, KnnModel::NUM_FEATURES, K, NUM_CLASSES> Engine;
+constexpr Engine engine = KnnModel::makeEngine<K, NUM_CLASSES>();
+
+// Field yang sama dengan SensorData (tanpa Arduino String)
+struct LogRow {
+    int lapNumber;
+    float afr;
+    float rpm;
+    float temp;
+    float tps;
+    float map_value;
+    double lat;
+    double lng;
+    float speed;
+    float incline;
+    float stroke;
+    int64_t timestampMicros;
+    int64_t utcMicros;
+};
+
+class FileLineReader : public ITextLineReader {
+public:
+    explicit FileLineReader(FILE* file) : file(file) {}
+    bool readLine(char* buffer, size_t size) override { return fgets(buffer, int(size), file) != nullptr; }
+
+private:
+    FILE* file;
+};
+
+// Sama dengan KNNClassifier::classify tanpa cache, backend FLOAT
+int classifyRow(const LogRow& row) {
+    const int rule = knnHybridRule(row);
+    if (rule >= 0) return rule;
+
+    float features[KnnModel::NUM_FEATURES];
+    engine.extract(row, features);
+    engine.normalize(features);
+    return engine.classifyScan(features);
+}
+
+void usage() {
+    fprintf(stderr, "Usage: sensor_pipeline SIM [--seconds S] [--seed N] [--out log.txt]\n"
+                    "       sensor_pipeline REPLAY <telemetry_data.txt> [--out log.txt]\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        usage();
+        return 2;
+    }
+
+    const bool replay = strcmp(argv[1], "REPLAY") == 0;
+    if (!replay && strcmp(argv[1], "SIM") != 0) {
+        usage();
+        return 2;
+    }
+    if (replay && argc < 3) {
+        usage();
+        return 2;
+    }
+
+    SimLapProfile profile = SIM_DEFAULT_PROFILE;
+    unsigned long seconds = 600;
+    const char* outputPath = nullptr;
+    for (int i = replay ? 3 : 2; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--seconds") == 0 && !replay) {
+            seconds = strtoul(argv[i + 1], nullptr, 10);
+        } else if (strcmp(argv[i], "--seed") == 0 && !replay) {
+            profile.noiseSeed = uint32_t(strtoul(argv[i + 1], nullptr, 0));
+        } else if (strcmp(argv[i], "--out") == 0) {
+            outputPath = argv[i + 1];
+        } else {
+            fprintf(stderr, "ERROR: unknown option '%s'\n", argv[i]);
+            return 2;
+        }
+    }
+
+    FILE* in = nullptr;
+    if (replay) {
+        in = fopen(argv[2], "r");
+        if (!in) {
+            fprintf(stderr, "ERROR: cannot read %s\n", argv[2]);
+            return 1;
+        }
+    }
+    FileLineReader reader(in);
+    SimulatedSensorSource simulated(profile);
+    ReplaySensorSource replayed(reader, ReplaySpeed::AS_FAST_AS_POSSIBLE);
+    ISensorSource& source = replay ? static_cast<ISensorSource&>(replayed) : simulated;
+
+    FILE* out = nullptr;
+    if (outputPath) {
+        out = fopen(outputPath, "w");
+        if (!out) {
+            fprintf(stderr, "ERROR: cannot write %s\n", outputPath);
+            return 1;
+        }
+        fprintf(out, "lapNumber,afr,rpm,temp,tps,map,lat,lng,speed,incline,stroke,timestamp,utc\n%s\n",
+                TELEMETRY_LOG_MICROS_MARKER);
+    }
+
+    if (!source.begin(0)) {
+        fprintf(stderr, "ERROR: source %s has no data\n", source.name());
+        return 1;
+    }
+
+    // Loop seperti SensorManager::update + classify, dengan waktu simulasi
+    uint32_t lapCounts[MAX_LAPS + 1][NUM_CLASSES] = {};
+    uint32_t checksum = 2166136261u;  // FNV-1a atas urutan kelas
+    size_t rows = 0;
+    const unsigned long endMillis = seconds * 1000;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long now = 0; replay ? !source.finished() : now < endMillis; now += STEP_MILLIS) {
+        source.poll(now);
+        SensorReading reading;
+        if (source.read(now, SENSOR_ALL_CHANNELS, reading) == 0) continue;
+
+        LogRow row;
+        row.afr = reading.afr;
+        row.rpm = reading.rpm;
+        row.temp = reading.temp;
+        row.tps = reading.tps;
+        row.map_value = reading.map_value;
+        row.lat = reading.lat;
+        row.lng = reading.lng;
+        row.speed = reading.speed;
+        row.incline = reading.incline;
+        row.stroke = reading.stroke;
+        row.timestampMicros = int64_t(now) * 1000;
+        row.utcMicros = 0;  // tanpa jam GPS
+        if (replay) {
+            row.lapNumber = replayed.getLastLapNumber();
+        } else {
+            // Lap 0 = idle di pit sebelum lap pertama
+            const float t = now / 1000.0f;
+            row.lapNumber = t < profile.startupSeconds ? 0 : 1 + int((t - profile.startupSeconds) / profile.lapSeconds);
+        }
+
+        const int label = classifyRow(row);
+        checksum = (checksum ^ uint32_t(label)) * 16777619u;
+        const int lap = row.lapNumber < 0 || row.lapNumber > MAX_LAPS ? 0 : row.lapNumber;
+        lapCounts[lap][label]++;
+        rows++;
+
+        if (out) {
+            // Format sama dengan RecordingManager::appendDataToFile
+            fprintf(out, "%d,%.1f,%.0f,%.0f,%.0f,%.0f,%.4f,%.4f,%.0f,%.0f,%.0f,%lld,%lld\n", row.lapNumber, row.afr,
+                    row.rpm, row.temp, row.tps, row.map_value, row.lat, row.lng, row.speed, row.incline, row.stroke,
+                    (long long)row.timestampMicros, (long long)row.utcMicros);
+        }
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (in) fclose(in);
+    if (out) fclose(out);
+
+    if (rows == 0) {
+        fprintf(stderr, "ERROR: source %s produced no rows\n", source.name());
+        return 1;
+    }
+
+    printf("Source %s: %zu rows, %.0f rows/s (source + classify%s)\n", source.name(), rows,
+           elapsed > 0 ? rows / elapsed : 0.0, out ? " + log" : "");
+    printf("Model: %d samples%s, K=%d, FLOAT backend\n", KnnModel::NUM_SAMPLES,
+           KnnModel::isCondensed() ? " (condensed)" : "", K);
+    printf("Class sequence checksum: %08x\n", checksum);
+
+    printf("\nlap       rows     Normal    Startup  Maintenance   Critical\n");
+    for (int lap = 0; lap <= MAX_LAPS; lap++) {
+        uint32_t total = 0;
+        for (int c = 0; c < NUM_CLASSES; c++) total += lapCounts[lap][c];
+        if (total == 0) continue;
+        printf("%-5d %8u %10u %10u %12u %10u\n", lap, total, lapCounts[lap][0], lapCounts[lap][1],
+               lapCounts[lap][2], lapCounts[lap][3]);
+    }
+
+    if (outputPath) printf("\nWrote %s\n", outputPath);
+    return 0;
+}